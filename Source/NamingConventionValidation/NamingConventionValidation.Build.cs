@@ -28,8 +28,21 @@ namespace UnrealBuildTool.Rules
                     "SlateCore",
                     "UnrealEd",
                     "AssetRegistry",
+                    "AssetTools",
                     "EditorStyle",
-                    "Blutility"
+                    "EngineSettings",
+                    "Blutility",
+                    "ContentBrowser",
+                    "ContentBrowserData",
+                    "DataValidation",
+                    "DerivedDataCache",
+                    "DirectoryWatcher",
+                    "Json",
+                    "JsonUtilities",
+                    "Networking",
+                    "Projects",
+                    "PropertyEditor",
+                    "Sockets"
                 }
             );
         }
@@ -19,3 +19,18 @@ bool UEditorNamingValidatorBase::IsEnabled() const
 {
     return ItIsEnabled;
 }
+
+bool UEditorNamingValidatorBase::IsThreadSafe() const
+{
+    return false;
+}
+
+FNamingConventionNativeVerdict UEditorNamingValidatorBase::ValidateAssetNamingThreadSafe( const FNamingConventionValidationContext & /*context*/ ) const
+{
+    return FNamingConventionNativeVerdict();
+}
+
+FText UEditorNamingValidatorBase::GetThreadSafeVerdictMessage( const FNamingConventionValidationContext & /*context*/, const FNamingConventionNativeVerdict & /*verdict*/ ) const
+{
+    return FText::GetEmpty();
+}
@@ -1,25 +1,78 @@
 #include "EditorNamingValidatorSubsystem.h"
 
+#include "NamingConventionRuleDataAsset.h"
+#include "NamingConventionValidationAsyncAction.h"
+#include "NamingConventionValidationBaseline.h"
+#include "NamingConventionValidationBudget.h"
+#include "NamingConventionValidationCompiledMatcher.h"
+#include "NamingConventionValidationLog.h"
+#include "NamingConventionValidationMemory.h"
+#include "NamingConventionValidationNameBatch.h"
+#include "NamingConventionValidationRun.h"
 #include "NamingConventionValidationSettings.h"
 
 #include <AssetRegistry/AssetRegistryModule.h>
+#include <AssetToolsModule.h>
+#include <Async/ParallelFor.h>
 #include <Editor.h>
+#include <Engine/Blueprint.h>
 #include <EditorNamingValidatorBase.h>
 #include <EditorUtilityBlueprint.h>
+#include <Framework/Notifications/NotificationManager.h>
+#include <GeneralProjectSettings.h>
+#include <Interfaces/IPluginManager.h>
+#include <JsonObjectConverter.h>
 #include <Logging/MessageLog.h>
 #include <MessageLogInitializationOptions.h>
 #include <MessageLogModule.h>
+#include <Misc/PackageName.h>
 #include <Misc/ScopedSlowTask.h>
+#include <Misc/SecureHash.h>
+#include <Misc/UObjectToken.h>
+#include <Subsystems/ImportSubsystem.h>
 #include <UObject/UObjectHash.h>
+#include <Widgets/Notifications/SNotificationList.h>
+#include <WorldPartition/WorldPartitionActorDesc.h>
+#include <WorldPartition/WorldPartitionActorDescUtils.h>
 
 #define LOCTEXT_NAMESPACE "NamingConventionValidationManager"
 
+namespace
+{
+    // The tags of a blueprint are only updated when it is saved, while a loaded blueprint already has its new parent class once it is reparented.
+    // The parent classes of its parent blueprints are followed too, since their generated classes still have their previous super class until they are compiled
+    const UClass * FindLoadedBlueprintNativeParentClass( const FAssetData & asset_data )
+    {
+        const auto * blueprint = Cast< UBlueprint >( asset_data.FastGetAsset( false ) );
+        if ( blueprint == nullptr )
+        {
+            return nullptr;
+        }
+
+        const UClass * parent_class = blueprint->ParentClass;
+        while ( parent_class != nullptr && !parent_class->HasAnyClassFlags( CLASS_Native ) )
+        {
+            const auto * parent_blueprint = UBlueprint::GetBlueprintFromClass( parent_class );
+            parent_class = parent_blueprint != nullptr ? parent_blueprint->ParentClass : parent_class->GetSuperClass();
+        }
+
+        return parent_class;
+    }
+}
+
 bool TryGetAssetDataRealClass( FName & asset_class, const FAssetData & asset_data )
 {
     static const FName
         NativeParentClassKey( "NativeParentClass" ),
         NativeClassKey( "NativeClass" );
 
+    if ( const auto * native_parent_class = FindLoadedBlueprintNativeParentClass( asset_data ) )
+    {
+        const FSoftClassPath class_path( native_parent_class );
+        asset_class = *class_path.ToString();
+        return true;
+    }
+
     if ( !asset_data.GetTagValue( NativeParentClassKey, asset_class ) )
     {
         if ( !asset_data.GetTagValue( NativeClassKey, asset_class ) )
@@ -39,24 +92,207 @@ bool TryGetAssetDataRealClass( FName & asset_class, const FAssetData & asset_dat
     return true;
 }
 
+namespace
+{
+    // Path of the same class as TryGetAssetDataRealClass, without loading the asset
+    FTopLevelAssetPath GetAssetDataRealClassPath( const FAssetData & asset_data )
+    {
+        static const FName
+            NativeParentClassKey( "NativeParentClass" ),
+            NativeClassKey( "NativeClass" );
+
+        if ( const auto * native_parent_class = FindLoadedBlueprintNativeParentClass( asset_data ) )
+        {
+            return FTopLevelAssetPath( native_parent_class );
+        }
+
+        FString class_path;
+        if ( asset_data.GetTagValue( NativeParentClassKey, class_path ) || asset_data.GetTagValue( NativeClassKey, class_path ) )
+        {
+            return FSoftClassPath( class_path ).GetAssetPath();
+        }
+
+        return asset_data.AssetClassPath;
+    }
+
+    // nullptr when the class is not loaded
+    const UClass * FindLoadedClass( const FTopLevelAssetPath & class_path )
+    {
+        return class_path.IsValid() ? FindObject< UClass >( class_path ) : nullptr;
+    }
+
+    // Same class as TryGetAssetDataRealClass, but without loading the asset nor the class
+    const UClass * FindAssetDataRealClass( const FAssetData & asset_data )
+    {
+        return FindLoadedClass( GetAssetDataRealClassPath( asset_data ) );
+    }
+
+    // The version of the plugin of the module, or the one of the project for the modules of the project
+    FString GetNativeModuleVersion( const FName module_name )
+    {
+        for ( const auto & plugin : IPluginManager::Get().GetEnabledPlugins() )
+        {
+            const auto & descriptor = plugin->GetDescriptor();
+            if ( descriptor.Modules.ContainsByPredicate( [ module_name ]( const FModuleDescriptor & module_descriptor ) {
+                     return module_descriptor.Name == module_name;
+                 } ) )
+            {
+                return FString::Printf( TEXT( "%s %i %s" ), *plugin->GetName(), descriptor.Version, *descriptor.VersionName );
+            }
+        }
+
+        return GetDefault< UGeneralProjectSettings >()->ProjectVersion;
+    }
+
+    struct FRevalidationDelta
+    {
+        TMap< FName, ENamingConventionValidationResult > PreviousResults;
+        int32 NewlyInvalidCount = 0;
+        int32 NewlyValidCount = 0;
+    };
+
+    // The name and the path are built on the stack, to not allocate on the worker threads
+    template < typename TFunction >
+    auto CallWithValidationContext( const UClass * asset_class, const FAssetData & asset_data, TFunction && function )
+    {
+        TStringBuilder< 128 > asset_name;
+        asset_data.AssetName.AppendString( asset_name );
+
+        TStringBuilder< 256 > package_path;
+        asset_data.PackagePath.AppendString( package_path );
+
+        return function( FNamingConventionValidationContext { asset_data, asset_class, asset_name.ToView(), package_path.ToView() } );
+    }
+
+    FNamingConventionNativeVerdict ValidateAssetNamingThreadSafe( const UEditorNamingValidatorBase & validator, const UClass * asset_class, const FAssetData & asset_data )
+    {
+        return CallWithValidationContext( asset_class, asset_data, [ & ]( const FNamingConventionValidationContext & context ) {
+            return validator.ValidateAssetNamingThreadSafe( context );
+        } );
+    }
+
+    FText GetThreadSafeVerdictMessage( const UEditorNamingValidatorBase & validator, const UClass * asset_class, const FAssetData & asset_data, const FNamingConventionNativeVerdict & verdict )
+    {
+        return CallWithValidationContext( asset_class, asset_data, [ & ]( const FNamingConventionValidationContext & context ) {
+            return validator.GetThreadSafeVerdictMessage( context, verdict );
+        } );
+    }
+
+    FText GetWrongPrefixMessage( const FNamingConventionValidationClassDescription & class_description )
+    {
+        return FText::Format( LOCTEXT( "WrongPrefix", "Assets of class '{0}' must have a name which starts with {1}" ), FText::FromString( class_description.ClassPath.ToString() ), FText::FromString( class_description.Prefix ) );
+    }
+
+    FText GetWrongSuffixMessage( const FNamingConventionValidationClassDescription & class_description )
+    {
+        return FText::Format( LOCTEXT( "WrongSuffix", "Assets of class '{0}' must have a name which ends with {1}" ), FText::FromString( class_description.ClassPath.ToString() ), FText::FromString( class_description.Suffix ) );
+    }
+
+    // The class descriptions DoesAssetMatchesClassDescriptions evaluates for the class, in order: the ones of the most precise class the asset class derives from
+    void GatherApplicableClassDescriptions( TArray< int32, FNamingConventionScratchAllocator > & class_description_indices, TConstArrayView< FNamingConventionValidationClassDescription > class_descriptions, const UClass * asset_class )
+    {
+        class_description_indices.Reset();
+
+        const UClass * most_precise_class = nullptr;
+        for ( const auto & class_description : class_descriptions )
+        {
+            if ( asset_class->IsChildOf( class_description.Class ) && ( most_precise_class == nullptr || class_description.Class->IsChildOf( most_precise_class ) ) )
+            {
+                most_precise_class = class_description.Class;
+            }
+        }
+
+        for ( auto index = 0; index < class_descriptions.Num(); ++index )
+        {
+            if ( most_precise_class != nullptr && class_descriptions[ index ].Class == most_precise_class )
+            {
+                class_description_indices.Add( index );
+            }
+        }
+    }
+
+    // The class descriptions of the settings for INDEX_NONE, else the ones of the rule overlays
+    TConstArrayView< FNamingConventionValidationClassDescription > GetClassDescriptionSet( const UNamingConventionValidationSettings & settings, const FNamingConventionValidationRuleOverlays & rule_overlays, const int32 class_description_set_index )
+    {
+        return class_description_set_index != INDEX_NONE
+                   ? rule_overlays.GetClassDescriptionSet( class_description_set_index )
+                   : TConstArrayView< FNamingConventionValidationClassDescription >( settings.ClassDescriptions );
+    }
+
+    // The part of the verdict of IsAssetNamedCorrectly which only depends on the settings, from the name verdict of EvaluateNamesBatch
+    ENamingConventionValidationResult GetSettingsVerdict( FName & rule_id, const UNamingConventionValidationSettings & settings, const FNamingConventionValidationRuleOverlays & rule_overlays, const FAssetData & asset_data, const UClass * asset_class, const FNamingConventionNameVerdict & name_verdict )
+    {
+        static const FName BlueprintsPrefixRuleId( TEXT( "BlueprintsPrefix" ) );
+
+        rule_id = NAME_None;
+
+        TStringBuilder< 256 > package_name;
+        asset_data.PackageName.AppendString( package_name );
+
+        if ( settings.IsPathExcludedFromValidation( package_name.ToView() ) )
+        {
+            return ENamingConventionValidationResult::Excluded;
+        }
+
+        if ( settings.ExcludedClasses.ContainsByPredicate( [ & ]( const UClass * excluded_class ) {
+                 return asset_class->IsChildOf( excluded_class );
+             } ) )
+        {
+            return ENamingConventionValidationResult::Excluded;
+        }
+
+        if ( name_verdict.ClassDescriptionsResult == ENamingConventionValidationResult::Invalid )
+        {
+            const auto class_descriptions = GetClassDescriptionSet( settings, rule_overlays, name_verdict.ClassDescriptionSetIndex );
+            rule_id = class_descriptions[ name_verdict.FailedClassDescriptionIndex ].RuleId;
+            return ENamingConventionValidationResult::Invalid;
+        }
+
+        if ( name_verdict.ClassDescriptionsResult == ENamingConventionValidationResult::Valid )
+        {
+            return ENamingConventionValidationResult::Valid;
+        }
+
+        if ( name_verdict.ItHasEvaluatedBlueprintsPrefix )
+        {
+            if ( !name_verdict.ItMatchesBlueprintsPrefix )
+            {
+                rule_id = BlueprintsPrefixRuleId;
+                return ENamingConventionValidationResult::Invalid;
+            }
+
+            return ENamingConventionValidationResult::Valid;
+        }
+
+        return ENamingConventionValidationResult::Unknown;
+    }
+}
+
 UEditorNamingValidatorSubsystem::UEditorNamingValidatorSubsystem()
 {
     AllowBlueprintValidators = true;
+    ItHasBuiltProjectAssetNamesIndex = false;
+    ItHasBuiltImpactSnapshot = false;
+    LastBackgroundValidationProgressTime = 0.0;
 }
 
-void UEditorNamingValidatorSubsystem::Initialize( FSubsystemCollectionBase & /*collection*/ )
+void UEditorNamingValidatorSubsystem::Initialize( FSubsystemCollectionBase & collection )
 {
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
     const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
 
     if ( !asset_registry_module.Get().IsLoadingAssets() )
     {
         RegisterBlueprintValidators();
+        RegisterRuleAssets();
     }
     else
     {
         if ( !asset_registry_module.Get().OnFilesLoaded().IsBoundToObject( this ) )
         {
             asset_registry_module.Get().OnFilesLoaded().AddUObject( this, &UEditorNamingValidatorSubsystem::RegisterBlueprintValidators );
+            asset_registry_module.Get().OnFilesLoaded().AddUObject( this, &UEditorNamingValidatorSubsystem::RegisterRuleAssets );
         }
     }
 
@@ -78,6 +314,13 @@ void UEditorNamingValidatorSubsystem::Initialize( FSubsystemCollectionBase & /*c
         }
     }
 
+    // The added rule assets are registered, and the added packages join the index of the asset names and the impact snapshot once they are built
+    asset_registry_module.Get().OnAssetAdded().AddUObject( this, &UEditorNamingValidatorSubsystem::OnAssetAdded );
+
+    // The removed and renamed packages leave the result store, and the index of the asset names when it is built
+    asset_registry_module.Get().OnAssetRemoved().AddUObject( this, &UEditorNamingValidatorSubsystem::OnAssetRemoved );
+    asset_registry_module.Get().OnAssetRenamed().AddUObject( this, &UEditorNamingValidatorSubsystem::OnAssetRenamed );
+
     FMessageLogInitializationOptions init_options;
     init_options.bShowFilters = true;
 
@@ -86,256 +329,1729 @@ void UEditorNamingValidatorSubsystem::Initialize( FSubsystemCollectionBase & /*c
 
     auto * settings = GetMutableDefault< UNamingConventionValidationSettings >();
     settings->PostProcessSettings();
+    settings->OnSettingChanged().AddUObject( this, &UEditorNamingValidatorSubsystem::OnSettingsChanged );
+    RuleOverlays.Build( *settings );
+    GatherClassRuleHashes( ClassRuleHashes );
+
+    // The generated modules can start before or after the subsystem
+    UpdateCompiledMatcher();
+    FNamingConventionValidationCompiledMatcher::OnRegisteredTablesChanged().AddUObject( this, &UEditorNamingValidatorSubsystem::UpdateCompiledMatcher );
+
+    if ( GEditor != nullptr && !IsRunningCommandlet() )
+    {
+        GEditor->OnBlueprintPreCompile().AddUObject( this, &UEditorNamingValidatorSubsystem::OnBlueprintPreCompile );
+    }
+
+    // The compiled classes are cached by class address: a class can be destroyed by the garbage collection, and a blueprint class can be reparented when it compiles
+    FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject( this, &UEditorNamingValidatorSubsystem::ResetCompiledClassCache );
+    if ( GEditor != nullptr )
+    {
+        GEditor->OnBlueprintCompiled().AddUObject( this, &UEditorNamingValidatorSubsystem::ResetCompiledClassCache );
+    }
+
+    if ( auto * import_subsystem = collection.InitializeDependency< UImportSubsystem >() )
+    {
+        import_subsystem->OnAssetPostImport.AddUObject( this, &UEditorNamingValidatorSubsystem::OnAssetPostImport );
+    }
 }
 
 void UEditorNamingValidatorSubsystem::Deinitialize()
 {
     CleanupValidators();
 
+    if ( BackgroundValidationTickerHandle.IsValid() )
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker( BackgroundValidationTickerHandle );
+        BackgroundValidationTickerHandle.Reset();
+    }
+
+    BackgroundValidationRuns.Empty();
+    BackgroundValidationNotification.Reset();
+
+    // Their runs were dropped, so they would never finish
+    for ( auto * action : ActiveAsyncActions )
+    {
+        action->SetReadyToDestroy();
+    }
+    ActiveAsyncActions.Empty();
+
+    GetMutableDefault< UNamingConventionValidationSettings >()->OnSettingChanged().RemoveAll( this );
+    FNamingConventionValidationCompiledMatcher::OnRegisteredTablesChanged().RemoveAll( this );
+    FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll( this );
+    CompiledMatcherTable = nullptr;
+    CompiledClassCache.Reset( nullptr );
+
+    if ( GEditor != nullptr )
+    {
+        GEditor->OnBlueprintPreCompile().RemoveAll( this );
+        GEditor->OnBlueprintCompiled().RemoveAll( this );
+
+        if ( auto * import_subsystem = GEditor->GetEditorSubsystem< UImportSubsystem >() )
+        {
+            import_subsystem->OnAssetPostImport.RemoveAll( this );
+        }
+    }
+
+    if ( auto * asset_registry_module = FModuleManager::GetModulePtr< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ) )
+    {
+        asset_registry_module->Get().OnAssetAdded().RemoveAll( this );
+        asset_registry_module->Get().OnAssetRemoved().RemoveAll( this );
+        asset_registry_module->Get().OnAssetRenamed().RemoveAll( this );
+    }
+
     Super::Deinitialize();
 }
 
-int32 UEditorNamingValidatorSubsystem::ValidateAssets( const TArray< FAssetData > & asset_data_list, bool /*skip_excluded_directories*/, const bool show_if_no_failures ) const
+void UEditorNamingValidatorSubsystem::GetAssetsToValidate( TArray< FAssetData > & asset_data_list, const TArrayView< const FString > paths ) const
 {
     const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+    const auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get();
 
-    FScopedSlowTask slow_task( 1.0f, LOCTEXT( "NamingConventionValidatingDataTask", "Validating Naming Convention..." ) );
-    slow_task.Visibility = show_if_no_failures ? ESlowTaskVisibility::ForceVisible : ESlowTaskVisibility::Invisible;
+    // Folders are expanded here instead of using bRecursivePaths, so the excluded ones never reach the registry query
+    FARFilter filter;
+    filter.bRecursivePaths = false;
 
-    if ( show_if_no_failures )
+    TArray< FString > sub_paths;
+    for ( const auto & path : paths )
     {
-        slow_task.MakeDialogDelayed( 0.1f );
+        auto root_path = path;
+        root_path.RemoveFromEnd( TEXT( "/" ) );
+
+        sub_paths.Reset();
+        asset_registry.GetSubPaths( root_path, sub_paths, true );
+        sub_paths.Add( root_path );
+
+        for ( const auto & sub_path : sub_paths )
+        {
+            if ( !settings->IsFolderExcludedFromValidation( sub_path ) )
+            {
+                filter.PackagePaths.AddUnique( *sub_path );
+            }
+        }
     }
 
-    FMessageLog data_validation_log( "NamingConventionValidation" );
+    // An empty filter would return all the assets of the registry
+    if ( filter.PackagePaths.IsEmpty() )
+    {
+        return;
+    }
 
-    auto num_files_checked = 0;
-    auto num_valid_files = 0;
-    auto num_invalid_files = 0;
-    auto num_files_skipped = 0;
-    auto num_files_unable_to_validate = 0;
+    // With no class paths, the registry starts from UObject and removes the exclusion set along with its children
+    filter.bRecursiveClasses = true;
+    settings->GetAssetRegistryExcludedClassPaths( filter.RecursiveClassPathsExclusionSet );
 
-    const auto num_files_to_validate = asset_data_list.Num();
+    asset_registry.GetAssets( filter, asset_data_list );
+}
 
-    for ( const auto & asset_data : asset_data_list )
+int32 UEditorNamingValidatorSubsystem::ValidateAssets( const TArray< FAssetData > & asset_data_list, bool /*skip_excluded_directories*/, const bool show_if_no_failures ) const
+{
+    FNamingConventionValidationRun run( *this, asset_data_list, show_if_no_failures );
+    run.SetResultStore( &ValidationResults );
+    return ValidateAssetsInternal( run );
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::ValidateAsset( FText & error_message, FName & rule_id, const FAssetData & asset_data ) const
+{
+    FNamingConventionValidationVerdict asset_verdict;
+
+    FNamingConventionValidationRun run( *this, TArray< FAssetData > { asset_data }, false );
+    run.SetResultStore( &ValidationResults );
+    run.SetReportsToMessageLog( false );
+    run.SetOnVerdicts( [ &asset_verdict ]( const TConstArrayView< FNamingConventionValidationVerdict > verdicts ) {
+        asset_verdict = verdicts.Last();
+    } );
+    run.ProcessAssets();
+    run.Finish();
+
+    error_message = asset_verdict.Message;
+    rule_id = asset_verdict.RuleId;
+    return asset_verdict.Result;
+}
+
+int32 UEditorNamingValidatorSubsystem::ValidateAssetsWithBaseline( const TArray< FAssetData > & asset_data_list, FNamingConventionValidationBaseline & baseline, const bool show_if_no_failures ) const
+{
+    FNamingConventionValidationRun run( *this, asset_data_list, show_if_no_failures );
+    run.SetBaseline( &baseline );
+    run.SetResultStore( &ValidationResults );
+    return ValidateAssetsInternal( run );
+}
+
+int32 UEditorNamingValidatorSubsystem::ValidateAssetsWhileScanning( const TArrayView< const FString > paths, FNamingConventionValidationBaseline * baseline, const bool show_if_no_failures ) const
+{
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
+    // Short enough for the registry to be ticked often, so its gatherer thread never waits for the validation
+    static const double ValidationSliceSeconds = 0.05;
+
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+    auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get();
+
+    const auto start_time = FPlatformTime::Seconds();
+
+    TArray< FString > root_paths;
+    for ( const auto & path : paths )
     {
-        slow_task.EnterProgressFrame( 1.0f / num_files_to_validate, FText::Format( LOCTEXT( "ValidatingNamingConventionFilename", "Validating Naming Convention {0}" ), FText::FromString( asset_data.GetFullName() ) ) );
+        auto & root_path = root_paths.Add_GetRef( path );
+        root_path.RemoveFromEnd( TEXT( "/" ) );
+    }
 
-        FText error_message;
-        const auto result = IsAssetNamedCorrectly( error_message, asset_data );
+    // The same classes as the ones the registry query of GetAssetsToValidate excludes.
+    // Only the native classes are known before the scan, the blueprint classes deriving from the excluded classes are added after it
+    TSet< FTopLevelAssetPath > excluded_class_paths;
+    settings->GetAssetRegistryExcludedClassPaths( excluded_class_paths );
+    const auto excluded_base_class_paths = excluded_class_paths.Array();
+    asset_registry.GetDerivedClassNames( excluded_base_class_paths, TSet< FTopLevelAssetPath >(), excluded_class_paths );
 
-        switch ( result )
+    // The assets of a folder are discovered together, so the folders are only tested once
+    TMap< FName, bool > validated_folders;
+
+    const auto is_asset_to_validate = [ & ]( const FAssetData & asset_data ) {
+        if ( excluded_class_paths.Contains( asset_data.AssetClassPath ) )
         {
-            case ENamingConventionValidationResult::Excluded:
-            {
-                data_validation_log.Info()
-                    ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
-                    ->AddToken( FTextToken::Create( LOCTEXT( "ExcludedNamingConventionResult", "has not been tested based on the configuration." ) ) )
-                    ->AddToken( FTextToken::Create( error_message ) );
+            return false;
+        }
 
-                ++num_files_skipped;
-            }
-            break;
-            case ENamingConventionValidationResult::Valid:
-            {
-                ++num_valid_files;
-                ++num_files_checked;
-            }
-            break;
-            case ENamingConventionValidationResult::Invalid:
-            {
-                data_validation_log.Error()
-                    ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
-                    ->AddToken( FTextToken::Create( LOCTEXT( "InvalidNamingConventionResult", "does not match naming convention." ) ) )
-                    ->AddToken( FTextToken::Create( error_message ) );
+        if ( const auto * it_is_validated = validated_folders.Find( asset_data.PackagePath ) )
+        {
+            return *it_is_validated;
+        }
 
-                ++num_invalid_files;
-                ++num_files_checked;
-            }
-            break;
-            case ENamingConventionValidationResult::Unknown:
-            {
-                if ( show_if_no_failures && settings->bLogWarningWhenNoClassDescriptionForAsset )
-                {
-                    FFormatNamedArguments arguments;
-                    arguments.Add( TEXT( "ClassName" ), FText::FromString( asset_data.AssetClassPath.ToString() ) );
+        const auto package_path = asset_data.PackagePath.ToString();
+        const auto it_is_in_paths = root_paths.ContainsByPredicate( [ & ]( const FString & root_path ) {
+            return package_path == root_path || ( package_path.StartsWith( root_path ) && package_path[ root_path.Len() ] == TEXT( '/' ) );
+        } );
 
-                    data_validation_log.Warning()
-                        ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
-                        ->AddToken( FTextToken::Create( LOCTEXT( "UnknownNamingConventionResult", "has no known naming convention." ) ) )
-                        ->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "UnknownClass", " Class = {ClassName}" ), arguments ) ) );
-                }
-                ++num_files_checked;
-                ++num_files_unable_to_validate;
-            }
-            break;
+        return validated_folders.Add( asset_data.PackagePath, it_is_in_paths && !settings->IsFolderExcludedFromValidation( package_path ) );
+    };
+
+    FNamingConventionValidationRun run( *this, TArray< FAssetData >(), show_if_no_failures );
+    run.SetBaseline( baseline );
+    run.SetResultStore( &ValidationResults );
+
+    TSet< FSoftObjectPath > discovered_object_paths;
+    TArray< FAssetData > discovered_asset_data_list;
+    // The assets of blueprint classes, which can derive from an excluded class the scan did not find yet
+    TArray< FAssetData > deferred_asset_data_list;
+
+    // The registry broadcasts the assets it adds when it is ticked, on the game thread
+    const auto on_asset_added_handle = asset_registry.OnAssetAdded().AddLambda( [ & ]( const FAssetData & asset_data ) {
+        if ( !is_asset_to_validate( asset_data ) )
+        {
+            return;
+        }
+
+        discovered_object_paths.Add( asset_data.GetSoftObjectPath() );
+
+        TStringBuilder< 256 > class_package_name;
+        asset_data.AssetClassPath.GetPackageName().AppendString( class_package_name );
+
+        if ( FPackageName::IsScriptPackage( class_package_name.ToView() ) )
+        {
+            discovered_asset_data_list.Add( asset_data );
+        }
+        else
+        {
+            deferred_asset_data_list.Add( asset_data );
+        }
+    } );
+
+    // The registry can not scan only some paths asynchronously, so the paths are scanned first, then the rest of the project
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "Validating while scanning all the mount points of the project, the requested paths first" ) );
+    asset_registry.SearchAllAssets( false );
+
+    for ( const auto & root_path : root_paths )
+    {
+        asset_registry.PrioritizeSearchPath( root_path );
+    }
+
+    while ( asset_registry.IsLoadingAssets() )
+    {
+        asset_registry.Tick( -1.0f );
+
+        if ( discovered_asset_data_list.IsEmpty() && run.GetProcessedCount() == run.Num() )
+        {
+            // Nothing to validate until the gatherer adds more assets
+            FPlatformProcess::Sleep( 0.01f );
+            continue;
         }
+
+        run.AddAssets( discovered_asset_data_list );
+        discovered_asset_data_list.Reset();
+
+        // ReSharper disable once CppExpressionWithoutSideEffects
+        run.ProcessAssets( FPlatformTime::Seconds() + ValidationSliceSeconds );
+    }
+
+    asset_registry.OnAssetAdded().Remove( on_asset_added_handle );
+
+    const auto scan_seconds = FPlatformTime::Seconds() - start_time;
+
+    // The assets the registry knew before the scan are not added again, so they are only found now
+    TArray< FAssetData > asset_data_list;
+    GetAssetsToValidate( asset_data_list, paths );
+
+    const auto discovered_count = discovered_object_paths.Num();
+
+    // Like the registry query of GetAssetsToValidate, now that all the blueprint classes are known
+    asset_registry.GetDerivedClassNames( excluded_base_class_paths, TSet< FTopLevelAssetPath >(), excluded_class_paths );
+
+    discovered_asset_data_list.Append( deferred_asset_data_list.FilterByPredicate( [ & ]( const FAssetData & asset_data ) {
+        return !excluded_class_paths.Contains( asset_data.AssetClassPath );
+    } ) );
+
+    discovered_asset_data_list.Append( asset_data_list.FilterByPredicate( [ & ]( const FAssetData & asset_data ) {
+        return !discovered_object_paths.Contains( asset_data.GetSoftObjectPath() );
+    } ) );
+
+    run.AddAssets( discovered_asset_data_list );
+
+    while ( !run.ProcessAssets() )
+    {
+    }
+
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "Validated %i assets while scanning : the scan took %.2f seconds, the validation ended %.2f seconds after it. %i assets were discovered by the scan" ),
+        run.Num(),
+        scan_seconds,
+        FPlatformTime::Seconds() - start_time - scan_seconds,
+        discovered_count );
+
+    return run.Finish();
+}
+
+TSharedRef< FNamingConventionValidationRun > UEditorNamingValidatorSubsystem::ValidateAssetsInBackground( TArray< FAssetData > asset_data_list, const bool show_if_no_failures )
+{
+    const auto run = MakeShared< FNamingConventionValidationRun >( *this, MoveTemp( asset_data_list ), show_if_no_failures );
+    run->SetResultStore( &ValidationResults );
+    run->SetWaitsForVerdictCache( false );
+    BackgroundValidationRuns.Add( run );
+
+    if ( !BackgroundValidationTickerHandle.IsValid() )
+    {
+        BackgroundValidationTickerHandle = FTSTicker::GetCoreTicker().AddTicker( FTickerDelegate::CreateUObject( this, &UEditorNamingValidatorSubsystem::TickBackgroundValidation ) );
+    }
+
+    return run;
+}
+
+void UEditorNamingValidatorSubsystem::CancelBackgroundValidation()
+{
+    for ( const auto & run : BackgroundValidationRuns )
+    {
+        run->Cancel();
     }
+}
+
+bool UEditorNamingValidatorSubsystem::IsValidatingInBackground() const
+{
+    return !BackgroundValidationRuns.IsEmpty();
+}
+
+void UEditorNamingValidatorSubsystem::AddActiveAsyncAction( UNamingConventionValidationAsyncAction * action )
+{
+    ActiveAsyncActions.AddUnique( action );
+}
+
+void UEditorNamingValidatorSubsystem::RemoveActiveAsyncAction( UNamingConventionValidationAsyncAction * action )
+{
+    ActiveAsyncActions.RemoveSingleSwap( action );
+}
+
+const FNamingConventionValidationResultStore & UEditorNamingValidatorSubsystem::GetValidationResults() const
+{
+    return ValidationResults;
+}
 
-    const auto has_failed = num_invalid_files > 0;
+FSimpleMulticastDelegate & UEditorNamingValidatorSubsystem::OnValidationResultsChanged()
+{
+    return ValidationResults.OnResultsChanged();
+}
 
-    if ( has_failed || show_if_no_failures )
+bool UEditorNamingValidatorSubsystem::FindValidationResult( FNamingConventionValidationStoredResult & result, const FName package_name ) const
+{
+    if ( const auto * stored_result = ValidationResults.Find( package_name ) )
     {
-        FFormatNamedArguments arguments;
-        arguments.Add( TEXT( "Result" ), has_failed ? LOCTEXT( "Failed", "FAILED" ) : LOCTEXT( "Succeeded", "SUCCEEDED" ) );
-        arguments.Add( TEXT( "NumChecked" ), num_files_checked );
-        arguments.Add( TEXT( "NumValid" ), num_valid_files );
-        arguments.Add( TEXT( "NumInvalid" ), num_invalid_files );
-        arguments.Add( TEXT( "NumSkipped" ), num_files_skipped );
-        arguments.Add( TEXT( "NumUnableToValidate" ), num_files_unable_to_validate );
+        result = *stored_result;
+        return true;
+    }
+
+    return false;
+}
 
-        auto validation_log = has_failed ? data_validation_log.Error() : data_validation_log.Info();
-        validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "SuccessOrFailure", "NamingConvention Validation {Result}." ), arguments ) ) );
-        validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "ResultsSummary", "Files Checked: {NumChecked}, Passed: {NumValid}, Failed: {NumInvalid}, Skipped: {NumSkipped}, Unable to validate: {NumUnableToValidate}" ), arguments ) ) );
+TArray< FNamingConventionValidationStoredResult > UEditorNamingValidatorSubsystem::GetValidationResultsInPath( const FString & path, const bool only_invalid_results ) const
+{
+    TArray< FNamingConventionValidationStoredResult > results;
+    ValidationResults.GetResultsInPath( results, path, only_invalid_results );
+    return results;
+}
 
-        data_validation_log.Open( EMessageSeverity::Info, true );
+void UEditorNamingValidatorSubsystem::ValidateSavedPackage( const FName package_name )
+{
+    // The fingerprint holds the saved hash of the packages of the blueprint validators, and the properties of the rules
+    for ( const auto & [ validator_class, validator ] : Validators )
+    {
+        if ( validator_class != nullptr && validator_class->GetOutermost()->GetFName() == package_name )
+        {
+            InvalidateVerdictFingerprint();
+        }
+    }
+
+    if ( Rules.ContainsByPredicate( [ & ]( const UNamingConventionRuleDataAsset * rule ) {
+             return rule != nullptr && rule->GetPackage()->GetFName() == package_name;
+         } ) )
+    {
+        InvalidateVerdictFingerprint();
+    }
+
+    auto * settings = GetDefault< UNamingConventionValidationSettings >();
+    if ( !settings->bDoesValidateOnSave || GEditor->IsAutosaving() )
+    {
+        return;
+    }
+
+    SavedPackagesToValidate.AddUnique( package_name );
+
+    GEditor->GetTimerManager()->SetTimerForNextTick( this, &UEditorNamingValidatorSubsystem::ValidateAllSavedPackages );
+}
+
+void UEditorNamingValidatorSubsystem::AddValidator( UEditorNamingValidatorBase * validator )
+{
+    if ( validator )
+    {
+        if ( auto * replaced_validator = Validators.FindRef( validator->GetClass() ) )
+        {
+            ThreadSafeValidators.Remove( replaced_validator );
+        }
+
+        Validators.Add( validator->GetClass(), validator );
+        InvalidateVerdictFingerprint();
+
+        if ( validator->IsThreadSafe() )
+        {
+            ThreadSafeValidators.Add( validator );
+        }
+
+        SortValidators();
+    }
+}
+
+void UEditorNamingValidatorSubsystem::RegisterRule( UNamingConventionRuleDataAsset * rule )
+{
+    if ( rule == nullptr )
+    {
+        return;
+    }
+
+    // The assets of the classes removed from the rule lose its verdict too
+    const auto it_was_registered = Rules.Contains( rule );
+    auto class_paths = it_was_registered ? rule->GetClassPaths() : TArray< FTopLevelAssetPath >();
+    const auto it_applied_to_all_classes = it_was_registered && class_paths.IsEmpty();
+
+    AddRule( rule );
+
+    for ( const auto & class_path : rule->GetClassPaths() )
+    {
+        class_paths.AddUnique( class_path );
+    }
+
+    RevalidateAssetsOfRuleClasses( class_paths, it_applied_to_all_classes || rule->GetClassPaths().IsEmpty() );
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::IsAssetNamedCorrectly( FText & error_message, const FAssetData & asset_data, const bool can_use_editor_validators ) const
+{
+    FName rule_id;
+    return IsAssetNamedCorrectly( error_message, rule_id, asset_data, can_use_editor_validators );
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::IsAssetNamedCorrectly( FText & error_message, FName & rule_id, const FAssetData & asset_data, const bool can_use_editor_validators, const FNamingConventionAssetBatchVerdicts * batch_verdicts, FNamingConventionValidationBudget * validation_budget ) const
+{
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+    // The name is only needed during the call, a builder keeps it on the stack
+    TStringBuilder< 256 > package_name;
+    asset_data.PackageName.AppendString( package_name );
+
+    if ( settings->IsPathExcludedFromValidation( package_name.ToView() ) )
+    {
+        error_message = LOCTEXT( "ExcludedFolder", "The asset is in an excluded directory" );
+        return ENamingConventionValidationResult::Excluded;
+    }
+
+    if ( asset_data.IsRedirector() )
+    {
+        error_message = LOCTEXT( "ExcludedRedirector", "Redirectors are excluded from naming convention validation" );
+        return ENamingConventionValidationResult::Excluded;
+    }
+
+    // Checked before TryGetAssetDataRealClass which could load the actor package
+    if ( UNamingConventionValidationSettings::IsExternalActorPath( package_name.ToView() ) )
+    {
+        return DoesExternalActorMatchNameConvention( error_message, rule_id, asset_data );
+    }
+
+    FName asset_class;
+    if ( !TryGetAssetDataRealClass( asset_class, asset_data ) )
+    {
+        error_message = LOCTEXT( "UnknownClass", "The asset is of a class which has not been set up in the settings" );
+        return ENamingConventionValidationResult::Unknown;
+    }
+
+    return DoesAssetMatchNameConvention( error_message, rule_id, asset_data, asset_class, can_use_editor_validators, batch_verdicts, validation_budget );
+}
+
+void UEditorNamingValidatorSubsystem::EvaluateAssetBatch( FNamingConventionBatchVerdicts & verdicts, TConstArrayView< FAssetData > asset_data_list, FNamingConventionValidationBudget * validation_budget ) const
+{
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+    FNamingConventionValidationScratchScope scratch_scope;
+
+    const auto asset_count = asset_data_list.Num();
+    const auto validator_count = ThreadSafeValidators.Num();
+
+    verdicts.ValidatorCount = validator_count;
+    verdicts.AssetClasses.Reset( asset_count );
+    verdicts.Verdicts.Reset( asset_count * validator_count );
+    verdicts.Verdicts.AddDefaulted( asset_count * validator_count );
+
+    for ( const auto & asset_data : asset_data_list )
+    {
+        verdicts.AssetClasses.Add( FindAssetDataRealClass( asset_data ) );
+    }
+
+    EvaluateNamesBatch( verdicts, asset_data_list, *GetDefault< UNamingConventionValidationSettings >(), RuleOverlays, false );
+
+    verdicts.DisabledValidators.Init( false, validator_count );
+
+    if ( validator_count == 0 )
+    {
+        return;
+    }
+
+    if ( validation_budget != nullptr )
+    {
+        for ( auto validator_index = 0; validator_index < validator_count; ++validator_index )
+        {
+            verdicts.DisabledValidators[ validator_index ] = validation_budget->IsValidatorDisabled( ThreadSafeValidators[ validator_index ] );
+        }
+    }
+
+    // Each call is timed in its own slot, so the worker threads do not share anything, then the times are added to the budget
+    TArray< uint64, FNamingConventionScratchAllocator > call_cycles;
+    if ( validation_budget != nullptr )
+    {
+        call_cycles.SetNumZeroed( asset_count * validator_count );
+    }
+
+    ParallelFor( asset_count, [ & ]( const int32 asset_index ) {
+        // The LLM scopes are per thread, so each worker opens its own
+        LLM_SCOPE_BYTAG( NamingConventionValidation );
+
+        const auto * asset_class = verdicts.AssetClasses[ asset_index ];
+        if ( asset_class == nullptr )
+        {
+            return;
+        }
+
+        const auto & asset_data = asset_data_list[ asset_index ];
+        auto * asset_verdicts = verdicts.Verdicts.GetData() + asset_index * validator_count;
+
+        for ( auto validator_index = 0; validator_index < validator_count; ++validator_index )
+        {
+            const auto * validator = ThreadSafeValidators[ validator_index ];
+            if ( !validator->IsEnabled() || verdicts.DisabledValidators[ validator_index ] )
+            {
+                continue;
+            }
+
+            const auto start_cycles = FPlatformTime::Cycles64();
+            asset_verdicts[ validator_index ] = ValidateAssetNamingThreadSafe( *validator, asset_class, asset_data );
+
+            if ( validation_budget != nullptr )
+            {
+                call_cycles[ asset_index * validator_count + validator_index ] = FPlatformTime::Cycles64() - start_cycles;
+            }
+        }
+    } );
+
+    if ( validation_budget == nullptr )
+    {
+        return;
+    }
+
+    for ( auto asset_index = 0; asset_index < asset_count; ++asset_index )
+    {
+        for ( auto validator_index = 0; validator_index < validator_count; ++validator_index )
+        {
+            if ( const auto cycles = call_cycles[ asset_index * validator_count + validator_index ]; cycles > 0 )
+            {
+                validation_budget->AddValidatorCall( ThreadSafeValidators[ validator_index ], FPlatformTime::ToSeconds64( cycles ) );
+            }
+        }
+    }
+}
+
+FString UEditorNamingValidatorSubsystem::GetVerdictFingerprint() const
+{
+    // Serializing the settings, the validators and the rules is too slow to be done for each run, like the one of each asset the data validation validates
+    if ( VerdictFingerprint.IsEmpty() )
+    {
+        VerdictFingerprint = ComputeVerdictFingerprint();
+    }
+
+    return VerdictFingerprint;
+}
+
+void UEditorNamingValidatorSubsystem::InvalidateVerdictFingerprint()
+{
+    VerdictFingerprint.Reset();
+}
+
+FString UEditorNamingValidatorSubsystem::ComputeVerdictFingerprint() const
+{
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+    FString settings_string;
+    FJsonObjectConverter::UStructToJsonObjectString( settings->GetClass(), settings, settings_string, CPF_Config, 0 );
+
+    const auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get();
+
+    // The validators and the rules are sorted, so the fingerprint does not depend on the order they were registered in
+    TArray< FString > object_strings;
+
+    const auto add_object_string = [ & ]( const UObject * object ) {
+        const auto * object_class = object->GetClass();
+
+        FString object_string;
+        FJsonObjectConverter::UStructToJsonObjectString( object_class, object, object_string, CPF_Edit, 0 );
+        object_string = object_class->GetPathName() + object_string;
+
+        // The logic of the blueprint validators is in their package, and the one of the native validators in their module
+        if ( !object_class->HasAnyClassFlags( CLASS_Native ) )
+        {
+            if ( const auto package_data = asset_registry.GetAssetPackageDataCopy( object_class->GetOutermost()->GetFName() ) )
+            {
+                object_string += LexToString( package_data->GetPackageSavedHash() );
+            }
+        }
+        else
+        {
+            object_string += GetNativeModuleVersion( FPackageName::GetShortFName( object_class->GetOutermost()->GetFName() ) );
+        }
+
+        object_strings.Add( MoveTemp( object_string ) );
+    };
+
+    for ( const auto & [ validator_class, validator ] : Validators )
+    {
+        if ( validator != nullptr )
+        {
+            add_object_string( validator );
+        }
+    }
+
+    for ( const auto * rule : Rules )
+    {
+        if ( rule != nullptr )
+        {
+            object_strings.Add( rule->GetPathName() );
+            add_object_string( rule );
+        }
+    }
+
+    object_strings.Sort();
+
+    FSHA1 sha1;
+    const auto update_hash = [ & ]( const FString & string ) {
+        sha1.UpdateWithString( *string, string.Len() );
+    };
+
+    // The code of the plugin computes the verdicts of the settings
+    update_hash( GetNativeModuleVersion( TEXT( "NamingConventionValidation" ) ) );
+    update_hash( settings_string );
+    for ( const auto & object_string : object_strings )
+    {
+        update_hash( object_string );
+    }
+
+    sha1.Final();
+
+    FSHAHash hash;
+    sha1.GetHash( hash.Hash );
+    return hash.ToString();
+}
+
+bool UEditorNamingValidatorSubsystem::AnalyzeSettingsImpact( FNamingConventionSettingsImpact & impact, const UNamingConventionValidationSettings & candidate_settings )
+{
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
+    // Large batches, since the names of the batch are matched together and there is no progress to report
+    static const int32 ImpactBatchSize = 4096;
+
+    impact.Reset();
+
+    if ( !UpdateImpactSnapshot() )
+    {
+        return false;
+    }
+
+    const auto start_time = FPlatformTime::Seconds();
+    const auto & settings = *GetDefault< UNamingConventionValidationSettings >();
+
+    FNamingConventionValidationRuleOverlays candidate_rule_overlays;
+    candidate_rule_overlays.Build( candidate_settings );
+
+    const auto is_class_description_invalid = []( const FNamingConventionValidationClassDescription & class_description ) {
+        return class_description.Class == nullptr;
+    };
+
+    impact.InvalidClassDescriptionCount = candidate_settings.ClassDescriptions.FilterByPredicate( is_class_description_invalid ).Num();
+    for ( const auto & rule_overlay : candidate_settings.RuleOverlays )
+    {
+        impact.InvalidClassDescriptionCount += rule_overlay.ClassDescriptions.FilterByPredicate( is_class_description_invalid ).Num();
+    }
+
+    const auto asset_data_list = ImpactSnapshot.GetAssetDataList();
+    const auto asset_class_paths = ImpactSnapshot.GetAssetClassPaths();
+
+    // The classes are resolved once per analysis, so the blueprint classes unloaded since the snapshot was built are not used
+    TMap< FTopLevelAssetPath, const UClass * > resolved_classes;
+
+    FNamingConventionBatchVerdicts verdicts;
+    FNamingConventionBatchVerdicts candidate_verdicts;
+
+    for ( auto batch_start_index = 0; batch_start_index < asset_data_list.Num(); batch_start_index += ImpactBatchSize )
+    {
+        const auto batch_asset_count = FMath::Min( ImpactBatchSize, asset_data_list.Num() - batch_start_index );
+        const auto batch_asset_data_list = asset_data_list.Slice( batch_start_index, batch_asset_count );
+        const auto batch_asset_class_paths = asset_class_paths.Slice( batch_start_index, batch_asset_count );
+
+        verdicts.AssetClasses.Reset( batch_asset_count );
+        for ( const auto & asset_class_path : batch_asset_class_paths )
+        {
+            const auto * resolved_class = resolved_classes.Find( asset_class_path );
+            verdicts.AssetClasses.Add( resolved_class != nullptr ? *resolved_class : resolved_classes.Add( asset_class_path, FindLoadedClass( asset_class_path ) ) );
+        }
+
+        // Both settings are evaluated by the same name matching the validation uses
+        candidate_verdicts.AssetClasses = verdicts.AssetClasses;
+        EvaluateNamesBatch( verdicts, batch_asset_data_list, settings, RuleOverlays, true );
+        EvaluateNamesBatch( candidate_verdicts, batch_asset_data_list, candidate_settings, candidate_rule_overlays, true );
+
+        for ( auto asset_index = 0; asset_index < batch_asset_count; ++asset_index )
+        {
+            const auto * asset_class = verdicts.AssetClasses[ asset_index ];
+            if ( asset_class == nullptr )
+            {
+                ++impact.UnresolvedClassCount;
+                continue;
+            }
+
+            const auto & asset_data = batch_asset_data_list[ asset_index ];
+
+            FName previous_rule_id;
+            const auto previous_result = GetSettingsVerdict( previous_rule_id, settings, RuleOverlays, asset_data, asset_class, verdicts.NameVerdicts[ asset_index ] );
+
+            FName rule_id;
+            const auto result = GetSettingsVerdict( rule_id, candidate_settings, candidate_rule_overlays, asset_data, asset_class, candidate_verdicts.NameVerdicts[ asset_index ] );
+
+            impact.AddVerdicts( asset_data.PackageName, previous_result, previous_rule_id, result, rule_id );
+        }
+    }
+
+    impact.AssetCount = asset_data_list.Num();
+    impact.Seconds = FPlatformTime::Seconds() - start_time;
+    return true;
+}
+
+int32 UEditorNamingValidatorSubsystem::ValidateAssetsInternal( FNamingConventionValidationRun & run ) const
+{
+    // The progress is refreshed a few times per second, instead of formatting a text for each asset
+    static const double ProgressRefreshInterval = 0.1;
+
+    const auto show_if_no_failures = run.ShowsIfNoFailures();
+
+    FScopedSlowTask slow_task( run.Num(), LOCTEXT( "NamingConventionValidatingDataTask", "Validating Naming Convention..." ) );
+    slow_task.Visibility = show_if_no_failures ? ESlowTaskVisibility::ForceVisible : ESlowTaskVisibility::Invisible;
+
+    if ( show_if_no_failures )
+    {
+        slow_task.MakeDialogDelayed( 0.1f, true );
+    }
+
+    auto processed_count = 0;
+
+    while ( !run.ProcessAssets( FPlatformTime::Seconds() + ProgressRefreshInterval ) )
+    {
+        if ( slow_task.ShouldCancel() )
+        {
+            run.Cancel();
+            break;
+        }
+
+        slow_task.EnterProgressFrame( run.GetProcessedCount() - processed_count, FText::Format( LOCTEXT( "ValidatingNamingConventionProgress", "Validating Naming Convention {0} / {1}" ), run.GetProcessedCount(), run.Num() ) );
+        processed_count = run.GetProcessedCount();
+    }
+
+    return run.Finish();
+}
+
+bool UEditorNamingValidatorSubsystem::TickBackgroundValidation( float /*delta_time*/ )
+{
+    static const double ProgressRefreshInterval = 0.25;
+
+    if ( BackgroundValidationRuns.IsEmpty() )
+    {
+        BackgroundValidationTickerHandle.Reset();
+        return false;
+    }
+
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+    auto & run = BackgroundValidationRuns[ 0 ].Get();
+
+    if ( !BackgroundValidationNotification.IsValid() )
+    {
+        FNotificationInfo info( LOCTEXT( "NamingConventionValidatingDataTask", "Validating Naming Convention..." ) );
+        info.bFireAndForget = false;
+        info.ButtonDetails.Emplace(
+            LOCTEXT( "CancelBackgroundValidation", "Cancel" ),
+            LOCTEXT( "CancelBackgroundValidationTooltip", "Cancels the naming convention validation. The results found so far stay in the message log." ),
+            FSimpleDelegate::CreateUObject( this, &UEditorNamingValidatorSubsystem::CancelBackgroundValidation ),
+            SNotificationItem::CS_Pending );
+
+        BackgroundValidationNotification = FSlateNotificationManager::Get().AddNotification( info );
+        if ( BackgroundValidationNotification.IsValid() )
+        {
+            BackgroundValidationNotification->SetCompletionState( SNotificationItem::CS_Pending );
+        }
+
+        LastBackgroundValidationProgressTime = 0.0;
+    }
+
+    const auto is_complete = run.ProcessAssets( FPlatformTime::Seconds() + settings->BackgroundValidationTimeBudgetMs / 1000.0 );
+    const auto now = FPlatformTime::Seconds();
+
+    if ( is_complete )
+    {
+        const auto num_invalid_files = run.Finish();
+
+        if ( BackgroundValidationNotification.IsValid() )
+        {
+            BackgroundValidationNotification->SetText( run.IsCancelled()
+                                                           ? LOCTEXT( "BackgroundValidationCancelled", "Naming Convention Validation cancelled" )
+                                                           : FText::Format( LOCTEXT( "BackgroundValidationComplete", "Naming Convention Validation complete, {0} invalid assets" ), num_invalid_files ) );
+            BackgroundValidationNotification->SetCompletionState( num_invalid_files > 0 || run.IsCancelled() ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success );
+            BackgroundValidationNotification->ExpireAndFadeout();
+            BackgroundValidationNotification.Reset();
+        }
+
+        BackgroundValidationRuns.RemoveAt( 0 );
+    }
+    else if ( now - LastBackgroundValidationProgressTime >= ProgressRefreshInterval )
+    {
+        if ( BackgroundValidationNotification.IsValid() )
+        {
+            BackgroundValidationNotification->SetText( FText::Format( LOCTEXT( "ValidatingNamingConventionProgress", "Validating Naming Convention {0} / {1}" ), run.GetProcessedCount(), run.Num() ) );
+        }
+
+        LastBackgroundValidationProgressTime = now;
+    }
+
+    if ( BackgroundValidationRuns.IsEmpty() )
+    {
+        BackgroundValidationTickerHandle.Reset();
+        return false;
+    }
+
+    return true;
+}
+
+void UEditorNamingValidatorSubsystem::RegisterBlueprintValidators()
+{
+    if ( !AllowBlueprintValidators )
+    {
+        return;
+    }
+
+    // Locate all validators (include unloaded)
+    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
+    TArray< FAssetData > all_blueprint_asset_data;
+    asset_registry_module.Get().GetAssetsByClass( UEditorUtilityBlueprint::StaticClass()->GetClassPathName(), all_blueprint_asset_data, true );
+
+    for ( auto & asset_data : all_blueprint_asset_data )
+    {
+        FString parent_class_name;
+
+        if ( !asset_data.GetTagValue( FBlueprintTags::NativeParentClassPath, parent_class_name ) )
+        {
+            asset_data.GetTagValue( FBlueprintTags::ParentClassPath, parent_class_name );
+        }
+
+        if ( !parent_class_name.IsEmpty() )
+        {
+            const UClass* parent_class = nullptr;
+            UObject* Outer = nullptr;
+
+            ResolveName(Outer, parent_class_name, false, false);
+            parent_class = FindObject<UClass>(Outer, *parent_class_name);
+
+            if ( parent_class == nullptr
+                || !parent_class->IsChildOf( UEditorNamingValidatorBase::StaticClass() ) )
+            {
+                continue;
+            }
+        }
+
+        // If this object isn't currently loaded, load it
+        auto * validator_object = asset_data.ToSoftObjectPath().ResolveObject();
+        if ( validator_object == nullptr )
+        {
+            validator_object = asset_data.ToSoftObjectPath().TryLoad();
+        }
+        if ( validator_object )
+        {
+            const auto * validator_blueprint = Cast< UEditorUtilityBlueprint >( validator_object );
+            auto * validator = NewObject< UEditorNamingValidatorBase >( GetTransientPackage(), validator_blueprint->GeneratedClass );
+            AddValidator( validator );
+        }
+    }
+}
+
+void UEditorNamingValidatorSubsystem::RegisterRuleAssets()
+{
+    // Rule assets are data only, and they match their classes by path, so loading them does not load any blueprint
+    const auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get();
+    TArray< FAssetData > rule_asset_data_list;
+    asset_registry.GetAssetsByClass( UNamingConventionRuleDataAsset::StaticClass()->GetClassPathName(), rule_asset_data_list, true );
+
+    for ( const auto & asset_data : rule_asset_data_list )
+    {
+        AddRule( Cast< UNamingConventionRuleDataAsset >( asset_data.GetAsset() ) );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::AddRule( UNamingConventionRuleDataAsset * rule )
+{
+    if ( rule == nullptr )
+    {
+        return;
+    }
+
+    rule->CompileRule();
+    Rules.AddUnique( rule );
+    InvalidateVerdictFingerprint();
+    Rules.Sort( []( const UNamingConventionRuleDataAsset & left_rule, const UNamingConventionRuleDataAsset & right_rule ) {
+        return left_rule.GetPathName() < right_rule.GetPathName();
+    } );
+}
+
+void UEditorNamingValidatorSubsystem::RevalidateAssetsOfRuleClasses( const TConstArrayView< FTopLevelAssetPath > class_paths, const bool it_applies_to_all_classes )
+{
+    if ( IsRunningCommandlet() )
+    {
+        return;
+    }
+
+    if ( it_applies_to_all_classes )
+    {
+        // The rule can apply to any asset
+        ValidationResults.Invalidate();
+        return;
+    }
+
+    RevalidateAssetsDependingOnClasses( class_paths );
+}
+
+void UEditorNamingValidatorSubsystem::CleanupValidators()
+{
+    Validators.Empty();
+    ThreadSafeValidators.Empty();
+    SortedValidators.Empty();
+    SortedValidatorThreadSafeIndices.Empty();
+    Rules.Empty();
+    InvalidateVerdictFingerprint();
+}
+
+void UEditorNamingValidatorSubsystem::SortValidators()
+{
+    SortedValidators.Reset( Validators.Num() );
+
+    for ( const auto & [ validator_class, validator ] : Validators )
+    {
+        if ( validator != nullptr )
+        {
+            SortedValidators.Add( validator );
+        }
+    }
+
+    // Cheapest first: the thread safe validators, whose verdicts are evaluated in parallel beforehand, then the native ones, then the blueprint ones.
+    // The path of the class breaks the ties, so an asset failing several validators always reports the same one, whatever the order they were registered in
+    const auto get_cost_rank = []( const UEditorNamingValidatorBase & validator ) {
+        return validator.IsThreadSafe() ? 0 : validator.GetClass()->HasAnyClassFlags( CLASS_Native ) ? 1 : 2;
+    };
+
+    SortedValidators.Sort( [ & ]( const UEditorNamingValidatorBase & left, const UEditorNamingValidatorBase & right ) {
+        const auto left_rank = get_cost_rank( left );
+        const auto right_rank = get_cost_rank( right );
+        return left_rank != right_rank ? left_rank < right_rank : left.GetClass()->GetPathName() < right.GetClass()->GetPathName();
+    } );
+
+    // Looked up once here, instead of for each validator of each asset
+    SortedValidatorThreadSafeIndices.Reset( SortedValidators.Num() );
+    for ( const auto * validator : SortedValidators )
+    {
+        SortedValidatorThreadSafeIndices.Add( ThreadSafeValidators.IndexOfByKey( validator ) );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::ValidateAllSavedPackages()
+{
+    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( "AssetRegistry" );
+    TArray< FAssetData > assets;
+
+    for ( const auto package_name : SavedPackagesToValidate )
+    {
+        // We need to query the in-memory data as the disk cache may not be accurate
+        asset_registry_module.Get().GetAssetsByPackageName( package_name, assets );
+    }
+
+    ValidateOnSave( assets );
+
+    SavedPackagesToValidate.Empty();
+}
+
+void UEditorNamingValidatorSubsystem::ValidateOnSave( const TArray< FAssetData > & asset_data_list )
+{
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+    if ( !settings->bDoesValidateOnSave || GEditor->IsAutosaving() )
+    {
+        return;
+    }
+
+    FMessageLog data_validation_log( "NamingConventionValidation" );
+
+    FNamingConventionValidationRun run( *this, asset_data_list, false );
+    run.SetResultStore( &ValidationResults );
+
+    // Compare the saved assets with all the assets of the project, without having to scan them again
+    if ( settings->bDetectDuplicateAssetNames && UpdateProjectAssetNamesIndex() )
+    {
+        run.SetDuplicateNameIndex( &ProjectAssetNamesIndex );
+    }
+
+    if ( ValidateAssetsInternal( run ) > 0 )
+    {
+        const auto error_message_notification = FText::Format(
+            LOCTEXT( "ValidationFailureNotification", "Naming Convention Validation failed when saving {0}, check Naming Convention Validation log" ),
+            asset_data_list.Num() == 1 ? FText::FromName( asset_data_list[ 0 ].AssetName ) : LOCTEXT( "MultipleErrors", "multiple assets" ) );
+        data_validation_log.Notify( error_message_notification, EMessageSeverity::Warning, /*bForce=*/true );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::OnAssetPostImport( UFactory * /*factory*/, UObject * asset )
+{
+    if ( asset == nullptr || !GetDefault< UNamingConventionValidationSettings >()->bValidateOnImport )
+    {
+        return;
+    }
+
+    // An import of several files broadcasts one event per asset during the same frame
+    ImportedAssetsToValidate.AddUnique( asset );
+
+    GEditor->GetTimerManager()->SetTimerForNextTick( this, &UEditorNamingValidatorSubsystem::ValidateImportedAssets );
+}
+
+void UEditorNamingValidatorSubsystem::ValidateImportedAssets()
+{
+    TArray< UObject * > imported_assets;
+    for ( const auto & imported_asset : ImportedAssetsToValidate )
+    {
+        if ( auto * asset = imported_asset.Get() )
+        {
+            imported_assets.Add( asset );
+        }
+    }
+
+    ImportedAssetsToValidate.Empty();
+
+    // The timer is set for each asset of the import, the first one validates all of them
+    if ( imported_assets.IsEmpty() )
+    {
+        return;
+    }
+
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+    if ( settings->bApplyAffixesOnImport )
+    {
+        ApplyAffixesToImportedAssets( imported_assets );
+    }
+
+    TArray< FAssetData > asset_data_list;
+    asset_data_list.Reserve( imported_assets.Num() );
+
+    for ( const auto * asset : imported_assets )
+    {
+        asset_data_list.Emplace( asset );
+    }
+
+    FMessageLog data_validation_log( "NamingConventionValidation" );
+
+    FNamingConventionValidationRun run( *this, asset_data_list, false );
+    run.SetResultStore( &ValidationResults );
+
+    if ( settings->bDetectDuplicateAssetNames && UpdateProjectAssetNamesIndex() )
+    {
+        run.SetDuplicateNameIndex( &ProjectAssetNamesIndex );
+    }
+
+    if ( ValidateAssetsInternal( run ) > 0 )
+    {
+        const auto error_message_notification = FText::Format(
+            LOCTEXT( "ImportValidationFailureNotification", "Naming Convention Validation failed when importing {0}, check Naming Convention Validation log" ),
+            asset_data_list.Num() == 1 ? FText::FromName( asset_data_list[ 0 ].AssetName ) : LOCTEXT( "MultipleErrors", "multiple assets" ) );
+        data_validation_log.Notify( error_message_notification, EMessageSeverity::Warning, /*bForce=*/true );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::ApplyAffixesToImportedAssets( const TConstArrayView< UObject * > imported_assets ) const
+{
+    TArray< FAssetRenameData > rename_data_list;
+    TArray< FString > previous_names;
+    // The assets of one import can get the same fixed name, like the mesh and the skeleton of a FBX file. Only the first one is renamed
+    TSet< FString > fixed_package_names;
+
+    for ( auto * asset : imported_assets )
+    {
+        const auto package_name = asset->GetPackage()->GetName();
+
+        // Once the package is saved, renaming the asset would leave a redirector, like for a reimport
+        if ( FPackageName::DoesPackageExist( package_name ) )
+        {
+            continue;
+        }
+
+        FString fixed_name;
+        if ( !GetNameWithClassDescriptionAffixes( fixed_name, *asset ) )
+        {
+            continue;
+        }
+
+        // The validation reports the name when the fixed one is already used
+        const auto package_path = FPackageName::GetLongPackagePath( package_name );
+        const auto fixed_package_name = package_path / fixed_name;
+        if ( fixed_package_names.Contains( fixed_package_name ) || FindPackage( nullptr, *fixed_package_name ) != nullptr || FPackageName::DoesPackageExist( fixed_package_name ) )
+        {
+            continue;
+        }
+
+        fixed_package_names.Add( fixed_package_name );
+        previous_names.Add( asset->GetName() );
+        rename_data_list.Emplace( asset, package_path, fixed_name );
+    }
+
+    if ( rename_data_list.IsEmpty() )
+    {
+        return;
+    }
+
+    // The packages were never saved, and nothing references the assets yet, so there is nothing to fix up
+    if ( !FModuleManager::LoadModuleChecked< FAssetToolsModule >( TEXT( "AssetTools" ) ).Get().RenameAssets( rename_data_list ) )
+    {
+        return;
+    }
+
+    FMessageLog data_validation_log( "NamingConventionValidation" );
+
+    for ( auto index = 0; index < rename_data_list.Num(); ++index )
+    {
+        data_validation_log.Info()
+            ->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "ImportedAssetRenamed", "Renamed the imported asset {0} to {1}" ), FText::FromString( previous_names[ index ] ), FText::FromString( rename_data_list[ index ].NewName ) ) ) );
+    }
+}
+
+bool UEditorNamingValidatorSubsystem::GetNameWithClassDescriptionAffixes( FString & fixed_name, const UObject & asset ) const
+{
+    const FAssetData asset_data( &asset );
+
+    const auto * asset_class = FindAssetDataRealClass( asset_data );
+    if ( asset_class == nullptr )
+    {
+        asset_class = asset.GetClass();
+    }
+
+    FText error_message;
+    if ( GetDefault< UNamingConventionValidationSettings >()->IsPathExcludedFromValidation( asset_data.PackageName.ToString() ) || IsClassExcluded( error_message, asset_class ) )
+    {
+        return false;
+    }
+
+    const auto class_descriptions = GetClassDescriptions( RuleOverlays.FindClassDescriptionSet( asset_data.PackagePath ) );
+
+    FNamingConventionValidationScratchScope scratch_scope;
+    TArray< int32, FNamingConventionScratchAllocator > class_description_indices;
+    GatherApplicableClassDescriptions( class_description_indices, class_descriptions, asset_class );
+
+    const auto asset_name = asset_data.AssetName.ToString();
+
+    // The class descriptions of the same class are alternatives, like in DoesAssetMatchesClassDescriptions
+    const auto it_matches_class_description = class_description_indices.ContainsByPredicate( [ & ]( const int32 class_description_index ) {
+        const auto & class_description = class_descriptions[ class_description_index ];
+        return asset_name.StartsWith( class_description.Prefix ) && asset_name.EndsWith( class_description.Suffix );
+    } );
+
+    if ( class_description_indices.IsEmpty() || it_matches_class_description )
+    {
+        return false;
+    }
+
+    // The class descriptions are sorted by priority
+    const auto & class_description = class_descriptions[ class_description_indices[ 0 ] ];
+
+    fixed_name = asset_name;
+
+    if ( !fixed_name.StartsWith( class_description.Prefix ) )
+    {
+        fixed_name = class_description.Prefix + fixed_name;
+    }
+
+    if ( !fixed_name.EndsWith( class_description.Suffix ) )
+    {
+        fixed_name += class_description.Suffix;
+    }
+
+    return true;
+}
+
+bool UEditorNamingValidatorSubsystem::UpdateProjectAssetNamesIndex()
+{
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+    if ( ItHasBuiltProjectAssetNamesIndex && ProjectAssetNamesIndex.IsScopedByClass() == settings->bDuplicateAssetNamesAreScopedByClass )
+    {
+        return true;
+    }
+
+    auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get();
+
+    // The index would miss the assets not discovered yet
+    if ( asset_registry.IsLoadingAssets() )
+    {
+        return false;
+    }
+
+    TArray< FString > root_paths;
+    FPackageName::QueryRootContentPaths( root_paths );
+
+    TArray< FAssetData > asset_data_list;
+    GetAssetsToValidate( asset_data_list, root_paths );
+
+    ProjectAssetNamesIndex.Reset( settings->bDuplicateAssetNamesAreScopedByClass );
+    ProjectAssetNamesIndex.Reserve( asset_data_list.Num() );
+
+    for ( const auto & asset_data : asset_data_list )
+    {
+        ProjectAssetNamesIndex.Add( asset_data );
+    }
+
+    ItHasBuiltProjectAssetNamesIndex = true;
+    return true;
+}
+
+bool UEditorNamingValidatorSubsystem::UpdateImpactSnapshot()
+{
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
+    if ( ItHasBuiltImpactSnapshot )
+    {
+        return true;
+    }
+
+    auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get();
+
+    if ( asset_registry.IsLoadingAssets() )
+    {
+        return false;
+    }
+
+    // All the folders are kept, since the candidate settings can stop excluding some of them
+    TArray< FString > root_paths;
+    FPackageName::QueryRootContentPaths( root_paths );
+
+    FARFilter filter;
+    filter.bRecursivePaths = true;
+
+    for ( auto & root_path : root_paths )
+    {
+        root_path.RemoveFromEnd( TEXT( "/" ) );
+        filter.PackagePaths.Add( *root_path );
+    }
+
+    TArray< FAssetData > asset_data_list;
+    asset_registry.GetAssets( filter, asset_data_list );
+
+    ImpactSnapshot.Reset();
+    ImpactSnapshot.Reserve( asset_data_list.Num() );
+
+    for ( const auto & asset_data : asset_data_list )
+    {
+        ImpactSnapshot.Add( asset_data, GetAssetDataRealClassPath( asset_data ) );
+    }
+
+    ItHasBuiltImpactSnapshot = true;
+    return true;
+}
+
+void UEditorNamingValidatorSubsystem::OnAssetAdded( const FAssetData & asset_data )
+{
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
+    if ( ItHasBuiltProjectAssetNamesIndex && !asset_data.IsRedirector() )
+    {
+        const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+        TStringBuilder< 256 > package_name;
+        asset_data.PackageName.AppendString( package_name );
+
+        // The same folders and classes as the registry query of GetAssetsToValidate the index was built from
+        if ( !settings->IsPathExcludedFromValidation( package_name.ToView() ) && !IsAssetClassExcludedFromQuery( asset_data ) )
+        {
+            ProjectAssetNamesIndex.Add( asset_data );
+        }
+    }
+
+    if ( ItHasBuiltImpactSnapshot )
+    {
+        ImpactSnapshot.Add( asset_data, GetAssetDataRealClassPath( asset_data ) );
+    }
+
+    // The created, imported and renamed rule assets. The ones found by the initial scan are registered together by RegisterRuleAssets
+    if ( asset_data.IsInstanceOf( UNamingConventionRuleDataAsset::StaticClass() ) && !FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get().IsLoadingAssets() )
+    {
+        RegisterRule( Cast< UNamingConventionRuleDataAsset >( asset_data.GetAsset() ) );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::OnAssetRemoved( const FAssetData & asset_data )
+{
+    ProjectAssetNamesIndex.Remove( asset_data.PackageName, asset_data.AssetName, asset_data.AssetClassPath );
+    ImpactSnapshot.Remove( asset_data.GetSoftObjectPath() );
+    ValidationResults.Remove( asset_data.PackageName );
+
+    // The assets the removed rules applied to are validated again without them
+    TArray< FTopLevelAssetPath > removed_rule_class_paths;
+    auto it_removed_rule_applied_to_all_classes = false;
+    auto it_has_removed_rule = false;
+
+    Rules.RemoveAll( [ & ]( const UNamingConventionRuleDataAsset * rule ) {
+        if ( rule == nullptr )
+        {
+            return true;
+        }
+
+        if ( rule->GetPackage()->GetFName() != asset_data.PackageName )
+        {
+            return false;
+        }
+
+        it_has_removed_rule = true;
+        InvalidateVerdictFingerprint();
+        it_removed_rule_applied_to_all_classes |= rule->GetClassPaths().IsEmpty();
+        removed_rule_class_paths.Append( rule->GetClassPaths() );
+        return true;
+    } );
+
+    if ( it_has_removed_rule )
+    {
+        RevalidateAssetsOfRuleClasses( removed_rule_class_paths, it_removed_rule_applied_to_all_classes );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::OnAssetRenamed( const FAssetData & asset_data, const FString & old_object_path )
+{
+    const FSoftObjectPath old_path( old_object_path );
+    ProjectAssetNamesIndex.Remove( old_path.GetLongPackageFName(), old_path.GetAssetFName(), asset_data.AssetClassPath );
+    ImpactSnapshot.Remove( old_path );
+    ValidationResults.Remove( old_path.GetLongPackageFName() );
+
+    OnAssetAdded( asset_data );
+}
+
+void UEditorNamingValidatorSubsystem::OnSettingsChanged( UObject * /*settings*/, FPropertyChangedEvent & property_changed_event )
+{
+    InvalidateVerdictFingerprint();
+
+    QueryExcludedClassPaths.Reset();
+    IsQueryExcludedByClassPath.Reset();
+
+    const auto property_name = property_changed_event.GetMemberPropertyName();
+
+    // The overlays which extend the class descriptions of the settings include them
+    if ( property_name == GET_MEMBER_NAME_CHECKED( UNamingConventionValidationSettings, RuleOverlays ) || property_name == GET_MEMBER_NAME_CHECKED( UNamingConventionValidationSettings, ClassDescriptions ) || property_name.IsNone() )
+    {
+        RuleOverlays.Build( *GetDefault< UNamingConventionValidationSettings >() );
+        UpdateCompiledMatcher();
+    }
+
+    // Those only affect the assets of the classes they reference, which can be validated again right away
+    if ( property_name != GET_MEMBER_NAME_CHECKED( UNamingConventionValidationSettings, ClassDescriptions ) && property_name != GET_MEMBER_NAME_CHECKED( UNamingConventionValidationSettings, ExcludedClassPaths ) )
+    {
+        // The results were computed with the previous settings
+        ValidationResults.Invalidate();
+        return;
+    }
+
+    TMap< FTopLevelAssetPath, uint32 > class_rule_hashes;
+    GatherClassRuleHashes( class_rule_hashes );
+
+    TArray< FTopLevelAssetPath > changed_class_paths;
+    for ( const auto & pair : class_rule_hashes )
+    {
+        const auto * previous_hash = ClassRuleHashes.Find( pair.Key );
+        if ( previous_hash == nullptr || *previous_hash != pair.Value )
+        {
+            changed_class_paths.Add( pair.Key );
+        }
+    }
+
+    for ( const auto & pair : ClassRuleHashes )
+    {
+        if ( !class_rule_hashes.Contains( pair.Key ) )
+        {
+            changed_class_paths.Add( pair.Key );
+        }
+    }
+
+    ClassRuleHashes = MoveTemp( class_rule_hashes );
+
+    if ( !IsRunningCommandlet() )
+    {
+        RevalidateAssetsDependingOnClasses( changed_class_paths );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::GatherClassRuleHashes( TMap< FTopLevelAssetPath, uint32 > & class_rule_hashes ) const
+{
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+    for ( const auto & class_description : settings->ClassDescriptions )
+    {
+        auto & hash = class_rule_hashes.FindOrAdd( class_description.ClassPath.ToSoftObjectPath().GetAssetPath() );
+        hash = HashCombine( hash, FCrc::StrCrc32( *class_description.Prefix ) );
+        hash = HashCombine( hash, FCrc::StrCrc32( *class_description.Suffix ) );
+        hash = HashCombine( hash, GetTypeHash( class_description.Priority ) );
+    }
+
+    for ( const auto & class_path : settings->ExcludedClassPaths )
+    {
+        auto & hash = class_rule_hashes.FindOrAdd( class_path.ToSoftObjectPath().GetAssetPath() );
+        hash = HashCombine( hash, FCrc::StrCrc32( TEXT( "Excluded" ) ) );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::UpdateCompiledMatcher()
+{
+    CompiledMatcherTable = FNamingConventionValidationCompiledMatcher::FindTable( *GetDefault< UNamingConventionValidationSettings >() );
+    CompiledClassCache.Reset( CompiledMatcherTable );
+
+    // The verdicts do not change, only how they are computed
+    UE_LOG( LogNamingConventionValidation, Verbose, TEXT( "The class descriptions are matched %s" ), CompiledMatcherTable != nullptr ? TEXT( "with the compiled matcher" ) : TEXT( "dynamically" ) );
+}
+
+bool UEditorNamingValidatorSubsystem::IsAssetClassExcludedFromQuery( const FAssetData & asset_data ) const
+{
+    if ( const auto * it_is_excluded = IsQueryExcludedByClassPath.Find( asset_data.AssetClassPath ) )
+    {
+        return *it_is_excluded;
+    }
+
+    if ( QueryExcludedClassPaths.IsEmpty() )
+    {
+        GetDefault< UNamingConventionValidationSettings >()->GetAssetRegistryExcludedClassPaths( QueryExcludedClassPaths );
+    }
+
+    TArray< FTopLevelAssetPath > class_paths;
+    const auto it_knows_ancestors = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get().GetAncestorClassNames( asset_data.AssetClassPath, class_paths );
+    class_paths.Add( asset_data.AssetClassPath );
+
+    const auto it_is_excluded = class_paths.ContainsByPredicate( [ & ]( const FTopLevelAssetPath & class_path ) {
+        return QueryExcludedClassPaths.Contains( class_path );
+    } );
+
+    // The ancestors of a blueprint class are unknown until the registry discovers the blueprint
+    if ( it_knows_ancestors )
+    {
+        IsQueryExcludedByClassPath.Add( asset_data.AssetClassPath, it_is_excluded );
+    }
+
+    return it_is_excluded;
+}
+
+void UEditorNamingValidatorSubsystem::ResetCompiledClassCache()
+{
+    CompiledClassCache.Reset( CompiledMatcherTable );
+}
+
+bool UEditorNamingValidatorSubsystem::BenchmarkCompiledMatcher( FNamingConventionMatcherBenchmark & benchmark, const TConstArrayView< FAssetData > asset_data_list, const int32 iteration_count ) const
+{
+    if ( CompiledMatcherTable == nullptr )
+    {
+        return false;
+    }
+
+    // The assets of the classes which are not loaded are not matched by any matcher
+    TArray< const UClass * > asset_classes;
+    TArray< FString > asset_names;
+
+    for ( const auto & asset_data : asset_data_list )
+    {
+        if ( const auto * asset_class = FindAssetDataRealClass( asset_data ) )
+        {
+            asset_classes.Add( asset_class );
+            asset_names.Add( asset_data.AssetName.ToString() );
+        }
+    }
+
+    benchmark.AssetCount = asset_classes.Num();
+    benchmark.IterationCount = iteration_count;
+
+    const auto class_descriptions = GetClassDescriptions( INDEX_NONE );
+    FText error_message;
+    FName rule_id;
+
+    const auto time_matcher = [ & ]( const TFunctionRef< ENamingConventionValidationResult( int32 asset_index ) > match_name ) {
+        const auto start_time = FPlatformTime::Seconds();
+
+        for ( auto iteration = 0; iteration < iteration_count; ++iteration )
+        {
+            for ( auto asset_index = 0; asset_index < asset_classes.Num(); ++asset_index )
+            {
+                // ReSharper disable once CppExpressionWithoutSideEffects
+                match_name( asset_index );
+            }
+        }
+
+        return FPlatformTime::Seconds() - start_time;
+    };
+
+    // The compiled matchers report the verdicts like DoesAssetMatchesClassDescriptions, so the three of them do the same work
+    const auto match_compiled_class = [ & ]( const FNamingConventionCompiledClass * compiled_class, const int32 asset_index ) {
+        FNamingConventionNameVerdict name_verdict;
+        name_verdict.ClassDescriptionsResult = FNamingConventionValidationCompiledMatcher::MatchName( name_verdict.FailedClassDescriptionIndex, name_verdict.ItHasWrongSuffix, *CompiledMatcherTable, compiled_class, asset_names[ asset_index ] );
+        return GetClassDescriptionsResult( error_message, rule_id, name_verdict );
+    };
+
+    benchmark.DynamicSeconds = time_matcher( [ & ]( const int32 asset_index ) {
+        return DoesAssetMatchesClassDescriptions( error_message, rule_id, class_descriptions, asset_classes[ asset_index ], asset_names[ asset_index ] );
+    } );
+
+    benchmark.CompiledSeconds = time_matcher( [ & ]( const int32 asset_index ) {
+        return match_compiled_class( FNamingConventionValidationCompiledMatcher::FindClass( *CompiledMatcherTable, asset_classes[ asset_index ] ), asset_index );
+    } );
+
+    // A cache of its own, so the first lookup of each class is timed too
+    FNamingConventionCompiledClassCache compiled_class_cache;
+    compiled_class_cache.Reset( CompiledMatcherTable );
+
+    benchmark.CachedCompiledSeconds = time_matcher( [ & ]( const int32 asset_index ) {
+        return match_compiled_class( compiled_class_cache.FindClass( asset_classes[ asset_index ] ), asset_index );
+    } );
+
+    return true;
+}
+
+void UEditorNamingValidatorSubsystem::OnBlueprintPreCompile( UBlueprint * blueprint )
+{
+    // When a blueprint is reparented, its parent class changes before the compilation, while the generated class still has the previous one.
+    // The assets are validated with the parent class of the loaded blueprints, since the tags of the registry are only updated when they are saved
+    if ( blueprint == nullptr || blueprint->GeneratedClass == nullptr || blueprint->GeneratedClass->GetSuperClass() == blueprint->ParentClass )
+    {
+        return;
     }
 
-    return num_invalid_files;
+    // The ancestors of the class changed
+    IsQueryExcludedByClassPath.Reset();
+
+    const FTopLevelAssetPath class_path( blueprint->GeneratedClass );
+    RevalidateAssetsDependingOnClasses( MakeArrayView( &class_path, 1 ) );
 }
 
-void UEditorNamingValidatorSubsystem::ValidateSavedPackage( const FName package_name )
+void UEditorNamingValidatorSubsystem::GetAssetsDependingOnClasses( TArray< FAssetData > & asset_data_list, const TConstArrayView< FTopLevelAssetPath > class_paths ) const
 {
-    auto * settings = GetDefault< UNamingConventionValidationSettings >();
-    if ( !settings->bDoesValidateOnSave || GEditor->IsAutosaving() )
+    if ( class_paths.IsEmpty() )
     {
         return;
     }
 
-    SavedPackagesToValidate.AddUnique( package_name );
+    const auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get();
 
-    GEditor->GetTimerManager()->SetTimerForNextTick( this, &UEditorNamingValidatorSubsystem::ValidateAllSavedPackages );
-}
+    // Uses the parent classes stored in the registry, so the blueprints do not need to be loaded
+    TSet< FTopLevelAssetPath > derived_class_paths;
+    asset_registry.GetDerivedClassNames( TArray< FTopLevelAssetPath >( class_paths ), TSet< FTopLevelAssetPath >(), derived_class_paths );
 
-void UEditorNamingValidatorSubsystem::AddValidator( UEditorNamingValidatorBase * validator )
-{
-    if ( validator )
+    FARFilter class_filter;
+    FARFilter blueprint_filter;
+
+    for ( const auto & class_path : derived_class_paths )
     {
-        Validators.Add( validator->GetClass(), validator );
+        class_filter.ClassPaths.Add( class_path );
+
+        // The blueprints are in the package of their generated class
+        if ( !FPackageName::IsScriptPackage( class_path.GetPackageName().ToString() ) )
+        {
+            blueprint_filter.PackageNames.Add( class_path.GetPackageName() );
+        }
     }
-}
 
-ENamingConventionValidationResult UEditorNamingValidatorSubsystem::IsAssetNamedCorrectly( FText & error_message, const FAssetData & asset_data, bool can_use_editor_validators ) const
-{
-    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
-    if ( settings->IsPathExcludedFromValidation( asset_data.PackageName.ToString() ) )
+    if ( !class_filter.ClassPaths.IsEmpty() )
     {
-        error_message = LOCTEXT( "ExcludedFolder", "The asset is in an excluded directory" );
-        return ENamingConventionValidationResult::Excluded;
+        asset_registry.GetAssets( class_filter, asset_data_list );
     }
 
-    FName asset_class;
-    if ( !TryGetAssetDataRealClass( asset_class, asset_data ) )
+    if ( !blueprint_filter.PackageNames.IsEmpty() )
     {
-        error_message = LOCTEXT( "UnknownClass", "The asset is of a class which has not been set up in the settings" );
-        return ENamingConventionValidationResult::Unknown;
-    }
+        TSet< FSoftObjectPath > asset_paths;
+        asset_paths.Reserve( asset_data_list.Num() );
+
+        for ( const auto & asset_data : asset_data_list )
+        {
+            asset_paths.Add( asset_data.GetSoftObjectPath() );
+        }
 
-    return DoesAssetMatchNameConvention( error_message, asset_data, asset_class, can_use_editor_validators );
+        TArray< FAssetData > blueprint_asset_data_list;
+        asset_registry.GetAssets( blueprint_filter, blueprint_asset_data_list );
+
+        for ( auto & asset_data : blueprint_asset_data_list )
+        {
+            if ( !asset_paths.Contains( asset_data.GetSoftObjectPath() ) )
+            {
+                asset_data_list.Add( MoveTemp( asset_data ) );
+            }
+        }
+    }
 }
 
-void UEditorNamingValidatorSubsystem::RegisterBlueprintValidators()
+void UEditorNamingValidatorSubsystem::RevalidateAssetsDependingOnClasses( const TConstArrayView< FTopLevelAssetPath > class_paths )
 {
-    if ( !AllowBlueprintValidators )
+    TArray< FAssetData > asset_data_list;
+    GetAssetsDependingOnClasses( asset_data_list, class_paths );
+
+    if ( asset_data_list.IsEmpty() )
     {
         return;
     }
 
-    // Locate all validators (include unloaded)
-    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
-    TArray< FAssetData > all_blueprint_asset_data;
-    asset_registry_module.Get().GetAssetsByClass( UEditorUtilityBlueprint::StaticClass()->GetClassPathName(), all_blueprint_asset_data, true );
+    // Only the assets whose result changes are reported
+    const auto delta = MakeShared< FRevalidationDelta >();
+    delta->PreviousResults.Reserve( asset_data_list.Num() );
 
-    for ( auto & asset_data : all_blueprint_asset_data )
+    for ( const auto & asset_data : asset_data_list )
     {
-        FString parent_class_name;
-
-        if ( !asset_data.GetTagValue( FBlueprintTags::NativeParentClassPath, parent_class_name ) )
+        if ( const auto * previous_result = ValidationResults.Find( asset_data.PackageName ) )
         {
-            asset_data.GetTagValue( FBlueprintTags::ParentClassPath, parent_class_name );
+            delta->PreviousResults.Add( asset_data.PackageName, previous_result->Result );
         }
+    }
 
-        if ( !parent_class_name.IsEmpty() )
-        {
-            const UClass* parent_class = nullptr;
-            UObject* Outer = nullptr;
+    const auto run = ValidateAssetsInBackground( MoveTemp( asset_data_list ), false );
+    run->SetReportsToMessageLog( false );
 
-            ResolveName(Outer, parent_class_name, false, false);
-            parent_class = FindObject<UClass>(Outer, *parent_class_name);
+    run->SetOnVerdicts( [ delta ]( const TConstArrayView< FNamingConventionValidationVerdict > verdicts ) {
+        FMessageLog data_validation_log( "NamingConventionValidation" );
 
-            if ( parent_class == nullptr
-                || !parent_class->IsChildOf( UEditorNamingValidatorBase::StaticClass() ) )
+        for ( const auto & verdict : verdicts )
+        {
+            // The assets which were not evaluated keep their previous result
+            const auto * previous_result = delta->PreviousResults.Find( verdict.PackageName );
+            if ( ( previous_result != nullptr && *previous_result == verdict.Result ) || verdict.RuleId == FNamingConventionValidationRun::NotEvaluatedRuleId )
             {
                 continue;
             }
+
+            if ( verdict.Result == ENamingConventionValidationResult::Invalid )
+            {
+                data_validation_log.Error()
+                    ->AddToken( FAssetNameToken::Create( verdict.PackageName.ToString() ) )
+                    ->AddToken( FTextToken::Create( LOCTEXT( "NewlyInvalidNamingConventionResult", "does not match naming convention anymore." ) ) )
+                    ->AddToken( FTextToken::Create( verdict.Message ) );
+
+                ++delta->NewlyInvalidCount;
+            }
+            else if ( previous_result != nullptr && *previous_result == ENamingConventionValidationResult::Invalid )
+            {
+                data_validation_log.Info()
+                    ->AddToken( FAssetNameToken::Create( verdict.PackageName.ToString() ) )
+                    ->AddToken( FTextToken::Create( LOCTEXT( "NewlyValidNamingConventionResult", "does not have a naming convention violation anymore." ) ) );
+
+                ++delta->NewlyValidCount;
+            }
         }
+    } );
 
-        // If this object isn't currently loaded, load it
-        auto * validator_object = asset_data.ToSoftObjectPath().ResolveObject();
-        if ( validator_object == nullptr )
+    run->SetOnFinished( [ delta ]( const int32 /*invalid_count*/, const bool /*was_cancelled*/ ) {
+        if ( delta->NewlyInvalidCount == 0 && delta->NewlyValidCount == 0 )
         {
-            validator_object = asset_data.ToSoftObjectPath().TryLoad();
+            return;
         }
-        if ( validator_object )
+
+        FMessageLog data_validation_log( "NamingConventionValidation" );
+        const auto summary = FText::Format( LOCTEXT( "RevalidationSummary", "Naming convention revalidation after a class change: {0} new violations, {1} fixed violations" ), delta->NewlyInvalidCount, delta->NewlyValidCount );
+        data_validation_log.Info( summary );
+
+        if ( delta->NewlyInvalidCount > 0 )
         {
-            const auto * validator_blueprint = Cast< UEditorUtilityBlueprint >( validator_object );
-            auto * validator = NewObject< UEditorNamingValidatorBase >( GetTransientPackage(), validator_blueprint->GeneratedClass );
-            AddValidator( validator );
+            data_validation_log.Notify( summary, EMessageSeverity::Warning, /*bForce=*/true );
         }
-    }
-}
-
-void UEditorNamingValidatorSubsystem::CleanupValidators()
-{
-    Validators.Empty();
+    } );
 }
 
-void UEditorNamingValidatorSubsystem::ValidateAllSavedPackages()
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesExternalActorMatchNameConvention( FText & error_message, FName & rule_id, const FAssetData & asset_data ) const
 {
-    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( "AssetRegistry" );
-    TArray< FAssetData > assets;
-
-    for ( const auto package_name : SavedPackagesToValidate )
+    // The actor descriptor is read from the asset registry tags, neither the level nor the actor get loaded
+    const auto actor_desc = FWorldPartitionActorDescUtils::GetActorDescriptorFromAssetData( asset_data );
+    if ( !actor_desc.IsValid() )
     {
-        // We need to query the in-memory data as the disk cache may not be accurate
-        asset_registry_module.Get().GetAssetsByPackageName( package_name, assets );
+        error_message = LOCTEXT( "NoActorDescriptor", "The external actor has no actor descriptor in the asset registry" );
+        return ENamingConventionValidationResult::Unknown;
     }
 
-    ValidateOnSave( assets );
+    // Use the blueprint class only if it is already loaded, and fallback to the native class otherwise
+    const auto * actor_class = actor_desc->GetBaseClass().IsValid() ? FindObject< UClass >( actor_desc->GetBaseClass() ) : nullptr;
+    if ( actor_class == nullptr )
+    {
+        actor_class = actor_desc->GetActorNativeClass();
+    }
 
-    SavedPackagesToValidate.Empty();
-}
+    const auto actor_label = actor_desc->GetActorLabel().ToString();
 
-void UEditorNamingValidatorSubsystem::ValidateOnSave( const TArray< FAssetData > & asset_data_list ) const
-{
-    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
-    if ( !settings->bDoesValidateOnSave || GEditor->IsAutosaving() )
+    if ( actor_class == nullptr || actor_label.IsEmpty() )
     {
-        return;
+        error_message = LOCTEXT( "NoActorLabel", "The external actor has no label or no known class" );
+        return ENamingConventionValidationResult::Unknown;
     }
 
-    FMessageLog data_validation_log( "NamingConventionValidation" );
-
-    if ( ValidateAssets( asset_data_list, true, false ) > 0 )
+    if ( IsClassExcluded( error_message, actor_class ) )
     {
-        const auto error_message_notification = FText::Format(
-            LOCTEXT( "ValidationFailureNotification", "Naming Convention Validation failed when saving {0}, check Naming Convention Validation log" ),
-            asset_data_list.Num() == 1 ? FText::FromName( asset_data_list[ 0 ].AssetName ) : LOCTEXT( "MultipleErrors", "multiple assets" ) );
-        data_validation_log.Notify( error_message_notification, EMessageSeverity::Warning, /*bForce=*/true );
+        return ENamingConventionValidationResult::Excluded;
     }
+
+    return DoesAssetMatchesClassDescriptions( error_message, rule_id, GetClassDescriptions( RuleOverlays.FindClassDescriptionSet( asset_data.PackagePath ) ), actor_class, actor_label );
 }
 
-ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchNameConvention( FText & error_message, const FAssetData & asset_data, const FName asset_class, bool can_use_editor_validators ) const
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchNameConvention( FText & error_message, FName & rule_id, const FAssetData & asset_data, const FName asset_class, bool can_use_editor_validators, const FNamingConventionAssetBatchVerdicts * batch_verdicts, FNamingConventionValidationBudget * validation_budget ) const
 {
     const auto * settings = GetDefault< UNamingConventionValidationSettings >();
     static const FTopLevelAssetPath BlueprintGeneratedClassName( FName( TEXT( "/" ) ), FName( TEXT( "BlueprintGeneratedClass" ) ) );
 
-    auto asset_name = asset_data.AssetName.ToString();
+    TStringBuilder< 128 > asset_name_string;
+    asset_data.AssetName.AppendString( asset_name_string );
+    auto asset_name = asset_name_string.ToView();
 
     // Starting UE4.27 (?) some blueprints now have BlueprintGeneratedClass as their AssetClass, and their name ends with a _C.
-    if ( asset_data.AssetClassPath == BlueprintGeneratedClassName )
+    if ( asset_data.AssetClassPath == BlueprintGeneratedClassName && asset_name.EndsWith( TEXT( "_C" ), ESearchCase::CaseSensitive ) )
     {
-        asset_name.RemoveFromEnd( TEXT( "_C" ), ESearchCase::CaseSensitive );
+        asset_name.LeftChopInline( 2 );
     }
 
     const FSoftClassPath asset_class_path( asset_class.ToString() );
@@ -351,14 +2067,34 @@ ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatc
 
         if ( can_use_editor_validators )
         {
-            result = DoesAssetMatchesValidators( error_message, asset_real_class, asset_data );
+            result = DoesAssetMatchesValidators( error_message, rule_id, asset_real_class, asset_data, batch_verdicts, validation_budget );
             if ( result != ENamingConventionValidationResult::Unknown )
             {
                 return result;
             }
         }
 
-        result = DoesAssetMatchesClassDescriptions( error_message, asset_real_class, asset_name );
+        result = DoesAssetMatchesRules( error_message, rule_id, asset_real_class, asset_data, asset_name );
+        if ( result != ENamingConventionValidationResult::Unknown )
+        {
+            return result;
+        }
+
+        if ( batch_verdicts != nullptr && batch_verdicts->AssetClass == asset_real_class && batch_verdicts->NameVerdict.ItHasEvaluatedClassDescriptions )
+        {
+            result = GetClassDescriptionsResult( error_message, rule_id, batch_verdicts->NameVerdict );
+        }
+        else if ( const auto class_description_set_index = RuleOverlays.FindClassDescriptionSet( asset_data.PackagePath ); CompiledMatcherTable != nullptr && class_description_set_index == INDEX_NONE )
+        {
+            FNamingConventionNameVerdict name_verdict;
+            name_verdict.ClassDescriptionsResult = FNamingConventionValidationCompiledMatcher::MatchName( name_verdict.FailedClassDescriptionIndex, name_verdict.ItHasWrongSuffix, *CompiledMatcherTable, CompiledClassCache.FindClass( asset_real_class ), asset_name );
+            result = GetClassDescriptionsResult( error_message, rule_id, name_verdict );
+        }
+        else
+        {
+            result = DoesAssetMatchesClassDescriptions( error_message, rule_id, GetClassDescriptions( class_description_set_index ), asset_real_class, asset_name );
+        }
+
         if ( result != ENamingConventionValidationResult::Unknown )
         {
             return result;
@@ -369,9 +2105,16 @@ ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatc
 
     if ( asset_data.AssetClassPath == BlueprintClassName || asset_data.AssetClassPath == BlueprintGeneratedClassName )
     {
-        if ( !asset_name.StartsWith( settings->BlueprintsPrefix ) )
+        const auto it_matches_blueprints_prefix = batch_verdicts != nullptr && batch_verdicts->NameVerdict.ItHasEvaluatedBlueprintsPrefix
+                                                      ? batch_verdicts->NameVerdict.ItMatchesBlueprintsPrefix
+                                                      : asset_name.StartsWith( settings->BlueprintsPrefix );
+
+        if ( !it_matches_blueprints_prefix )
         {
+            static const FName BlueprintsPrefixRuleId( TEXT( "BlueprintsPrefix" ) );
+
             error_message = FText::FromString( TEXT( "Generic blueprint assets must start with BP_" ) );
+            rule_id = BlueprintsPrefixRuleId;
             return ENamingConventionValidationResult::Invalid;
         }
 
@@ -397,13 +2140,12 @@ bool UEditorNamingValidatorSubsystem::IsClassExcluded( FText & error_message, co
     return false;
 }
 
-ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesClassDescriptions( FText & error_message, const UClass * asset_class, const FString & asset_name ) const
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesClassDescriptions( FText & error_message, FName & rule_id, const TConstArrayView< FNamingConventionValidationClassDescription > class_descriptions, const UClass * asset_class, const FStringView asset_name ) const
 {
-    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
     const UClass* MostPreciseClass = UObject::StaticClass();
     ENamingConventionValidationResult Result = ENamingConventionValidationResult::Unknown;
 
-    for ( const auto & class_description : settings->ClassDescriptions )
+    for ( const auto & class_description : class_descriptions )
     {
         if ( class_description.Class == nullptr ) 
         {
@@ -427,13 +2169,15 @@ ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatc
             MostPreciseClass = class_description.Class;
 
             error_message = FText::GetEmpty();
+            rule_id = NAME_None;
             Result = ENamingConventionValidationResult::Valid;
 
             if ( !class_description.Prefix.IsEmpty() )
             {
                 if ( !asset_name.StartsWith( class_description.Prefix ) )
                 {
-                    error_message = FText::Format( LOCTEXT( "WrongPrefix", "Assets of class '{0}' must have a name which starts with {1}" ), FText::FromString( class_description.ClassPath.ToString() ), FText::FromString( class_description.Prefix ) );
+                    error_message = GetWrongPrefixMessage( class_description );
+                    rule_id = class_description.RuleId;
                     Result = ENamingConventionValidationResult::Invalid;
                 }
             }
@@ -442,7 +2186,8 @@ ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatc
             {
                 if ( !asset_name.EndsWith( class_description.Suffix ) )
                 {
-                    error_message = FText::Format( LOCTEXT( "WrongSuffix", "Assets of class '{0}' must have a name which ends with {1}" ), FText::FromString( class_description.ClassPath.ToString() ), FText::FromString( class_description.Suffix ) );
+                    error_message = GetWrongSuffixMessage( class_description );
+                    rule_id = class_description.RuleId;
                     Result = ENamingConventionValidationResult::Invalid;
                 }
             }
@@ -452,18 +2197,293 @@ ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatc
     return Result;
 }
 
-ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesValidators( FText & error_message, const UClass * asset_class, const FAssetData & asset_data ) const
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::GetClassDescriptionsResult( FText & error_message, FName & rule_id, const FNamingConventionNameVerdict & name_verdict ) const
+{
+    error_message = FText::GetEmpty();
+    rule_id = NAME_None;
+
+    if ( name_verdict.ClassDescriptionsResult != ENamingConventionValidationResult::Invalid )
+    {
+        return name_verdict.ClassDescriptionsResult;
+    }
+
+    // The settings can have changed since the batch was evaluated
+    const auto class_descriptions = GetClassDescriptions( name_verdict.ClassDescriptionSetIndex );
+    if ( !class_descriptions.IsValidIndex( name_verdict.FailedClassDescriptionIndex ) )
+    {
+        return ENamingConventionValidationResult::Unknown;
+    }
+
+    const auto & class_description = class_descriptions[ name_verdict.FailedClassDescriptionIndex ];
+    error_message = name_verdict.ItHasWrongSuffix ? GetWrongSuffixMessage( class_description ) : GetWrongPrefixMessage( class_description );
+    rule_id = class_description.RuleId;
+    return ENamingConventionValidationResult::Invalid;
+}
+
+void UEditorNamingValidatorSubsystem::EvaluateNamesBatch( FNamingConventionBatchVerdicts & verdicts, TConstArrayView< FAssetData > asset_data_list, const UNamingConventionValidationSettings & settings, const FNamingConventionValidationRuleOverlays & rule_overlays, const bool ignores_invalid_class_descriptions ) const
 {
-    for ( const auto & validator_pair : Validators )
+    static const FTopLevelAssetPath BlueprintClassName( FName( TEXT( "/Script/Engine" ) ), FName( TEXT( "Blueprint" ) ) );
+    static const FTopLevelAssetPath BlueprintGeneratedClassName( FName( TEXT( "/" ) ), FName( TEXT( "BlueprintGeneratedClass" ) ) );
+
+    const auto asset_count = asset_data_list.Num();
+
+    verdicts.NameVerdicts.Reset( asset_count );
+    verdicts.NameVerdicts.AddDefaulted( asset_count );
+
+    const auto is_class_description_invalid = []( const FNamingConventionValidationClassDescription & class_description ) {
+        return class_description.Class == nullptr;
+    };
+
+    // DoesAssetMatchesClassDescriptions reports the invalid class descriptions, so the assets are left to it.
+    // GatherApplicableClassDescriptions never selects them, so they can also be ignored
+    const auto it_has_invalid_class_description = !ignores_invalid_class_descriptions && ( settings.ClassDescriptions.ContainsByPredicate( is_class_description_invalid ) || settings.RuleOverlays.ContainsByPredicate( [ & ]( const FNamingConventionValidationRuleOverlay & rule_overlay ) {
+        return rule_overlay.ClassDescriptions.ContainsByPredicate( is_class_description_invalid );
+    } ) );
+
+    // The tables of the generated module only match the class descriptions of the current settings, not the ones of candidate settings
+    const auto * compiled_matcher_table = &settings == GetDefault< UNamingConventionValidationSettings >() ? CompiledMatcherTable : nullptr;
+
+    // The name of each asset is at the index of the asset in the batch
+    FNamingConventionValidationNameBatch names;
+    names.Reset( asset_count );
+
+    FNamingConventionValidationScratchScope scratch_scope;
+    TArray< int32, FNamingConventionScratchAllocator > blueprint_indices;
+
+    // The assets of the same class and in folders with the same class descriptions are matched together
+    TMap< TPair< const UClass *, int32 >, TArray< int32 > > asset_indices_per_group;
+
+    for ( auto asset_index = 0; asset_index < asset_count; ++asset_index )
+    {
+        const auto & asset_data = asset_data_list[ asset_index ];
+        const auto it_is_blueprint_generated_class = asset_data.AssetClassPath == BlueprintGeneratedClassName;
+
+        names.Add( asset_data.AssetName, it_is_blueprint_generated_class ? FStringView( TEXT( "_C" ) ) : FStringView() );
+
+        if ( it_is_blueprint_generated_class || asset_data.AssetClassPath == BlueprintClassName )
+        {
+            blueprint_indices.Add( asset_index );
+        }
+
+        if ( const auto * asset_class = verdicts.AssetClasses[ asset_index ]; asset_class != nullptr && !it_has_invalid_class_description )
+        {
+            const auto class_description_set_index = rule_overlays.FindClassDescriptionSet( asset_data.PackagePath );
+            verdicts.NameVerdicts[ asset_index ].ClassDescriptionSetIndex = class_description_set_index;
+            asset_indices_per_group.FindOrAdd( MakeTuple( asset_class, class_description_set_index ) ).Add( asset_index );
+        }
+    }
+
+    TBitArray< FNamingConventionScratchAllocator > blueprints_prefix_matches( false, blueprint_indices.Num() );
+    names.MatchPrefix( blueprints_prefix_matches, blueprint_indices, settings.BlueprintsPrefix, ESearchCase::IgnoreCase );
+
+    for ( auto index = 0; index < blueprint_indices.Num(); ++index )
+    {
+        auto & name_verdict = verdicts.NameVerdicts[ blueprint_indices[ index ] ];
+        name_verdict.ItHasEvaluatedBlueprintsPrefix = true;
+        name_verdict.ItMatchesBlueprintsPrefix = blueprints_prefix_matches[ index ];
+    }
+
+    const auto groups = asset_indices_per_group.Array();
+
+    // The compiled classes are looked up on the game thread, the cache is not read by the worker threads
+    TArray< const FNamingConventionCompiledClass *, FNamingConventionScratchAllocator > compiled_classes;
+    if ( compiled_matcher_table != nullptr )
     {
-        if ( validator_pair.Value != nullptr && validator_pair.Value->IsEnabled() && validator_pair.Value->CanValidateAssetNaming( asset_class, asset_data ) )
+        compiled_classes.Reserve( groups.Num() );
+
+        for ( const auto & group : groups )
+        {
+            compiled_classes.Add( group.Key.Value == INDEX_NONE ? CompiledClassCache.FindClass( group.Key.Key ) : nullptr );
+        }
+    }
+
+    auto * memory_stats = FNamingConventionValidationMemoryStats::GetCurrent();
+
+    // The groups only write the verdicts of their own assets, so the groups of different classes or mount points are matched concurrently
+    ParallelFor( groups.Num(), [ & ]( const int32 group_index ) {
+        LLM_SCOPE_BYTAG( NamingConventionValidation );
+        FNamingConventionValidationMemoryStats::FScope memory_stats_scope( memory_stats );
+
+        // The arrays of the group are released together when the group is matched
+        FNamingConventionValidationScratchScope group_scratch_scope;
+
+        const auto * asset_class = groups[ group_index ].Key.Key;
+        const auto class_descriptions = GetClassDescriptionSet( settings, rule_overlays, groups[ group_index ].Key.Value );
+        const auto & asset_indices = groups[ group_index ].Value;
+
+        for ( const auto asset_index : asset_indices )
+        {
+            verdicts.NameVerdicts[ asset_index ].ItHasEvaluatedClassDescriptions = true;
+        }
+
+        // Like DoesAssetMatchesClassDescriptions, the class descriptions are evaluated in order until one is valid
+        TArray< int32, FNamingConventionScratchAllocator > class_description_indices;
+        if ( compiled_matcher_table != nullptr && groups[ group_index ].Key.Value == INDEX_NONE )
+        {
+            FNamingConventionValidationCompiledMatcher::GatherClassDescriptions( class_description_indices, *compiled_matcher_table, compiled_classes[ group_index ] );
+        }
+        else
+        {
+            GatherApplicableClassDescriptions( class_description_indices, class_descriptions, asset_class );
+        }
+
+        TArray< int32, FNamingConventionScratchAllocator > pending_asset_indices( asset_indices );
+        TBitArray< FNamingConventionScratchAllocator > prefix_matches;
+        TBitArray< FNamingConventionScratchAllocator > suffix_matches;
+
+        for ( const auto class_description_index : class_description_indices )
         {
-            const auto result = validator_pair.Value->ValidateAssetNaming( error_message, asset_class, asset_data );
+            const auto & class_description = class_descriptions[ class_description_index ];
+
+            prefix_matches.Init( true, pending_asset_indices.Num() );
+            suffix_matches.Init( true, pending_asset_indices.Num() );
 
-            if ( result != ENamingConventionValidationResult::Valid )
+            if ( !class_description.Prefix.IsEmpty() )
             {
-                return result;
+                names.MatchPrefix( prefix_matches, pending_asset_indices, class_description.Prefix, ESearchCase::IgnoreCase );
+            }
+
+            if ( !class_description.Suffix.IsEmpty() )
+            {
+                names.MatchSuffix( suffix_matches, pending_asset_indices, class_description.Suffix, ESearchCase::IgnoreCase );
+            }
+
+            auto pending_count = 0;
+            for ( auto index = 0; index < pending_asset_indices.Num(); ++index )
+            {
+                const auto asset_index = pending_asset_indices[ index ];
+                auto & name_verdict = verdicts.NameVerdicts[ asset_index ];
+
+                if ( prefix_matches[ index ] && suffix_matches[ index ] )
+                {
+                    name_verdict.ClassDescriptionsResult = ENamingConventionValidationResult::Valid;
+                    name_verdict.FailedClassDescriptionIndex = INDEX_NONE;
+                    name_verdict.ItHasWrongSuffix = false;
+                    continue;
+                }
+
+                // The suffix error replaces the prefix one, like in DoesAssetMatchesClassDescriptions
+                name_verdict.ClassDescriptionsResult = ENamingConventionValidationResult::Invalid;
+                name_verdict.FailedClassDescriptionIndex = class_description_index;
+                name_verdict.ItHasWrongSuffix = !suffix_matches[ index ];
+                pending_asset_indices[ pending_count++ ] = asset_index;
+            }
+
+            pending_asset_indices.SetNum( pending_count, EAllowShrinking::No );
+
+            if ( pending_asset_indices.IsEmpty() )
+            {
+                break;
+            }
+        }
+    } );
+}
+
+TConstArrayView< FNamingConventionValidationClassDescription > UEditorNamingValidatorSubsystem::GetClassDescriptions( const int32 class_description_set_index ) const
+{
+    return GetClassDescriptionSet( *GetDefault< UNamingConventionValidationSettings >(), RuleOverlays, class_description_set_index );
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesRules( FText & error_message, FName & rule_id, const UClass * asset_class, const FAssetData & asset_data, const FStringView asset_name ) const
+{
+    if ( Rules.IsEmpty() )
+    {
+        return ENamingConventionValidationResult::Unknown;
+    }
+
+    TStringBuilder< 256 > package_path;
+    asset_data.PackagePath.AppendString( package_path );
+
+    // Like the validators, a rule which passes does not prevent the next ones or the class descriptions from being checked
+    for ( const auto * rule : Rules )
+    {
+        if ( rule != nullptr && rule->IsEnabled() && rule->ValidateAssetName( error_message, asset_class, package_path.ToView(), asset_name ) == ENamingConventionValidationResult::Invalid )
+        {
+            rule_id = rule->GetRuleId();
+            return ENamingConventionValidationResult::Invalid;
+        }
+    }
+
+    return ENamingConventionValidationResult::Unknown;
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesValidators( FText & error_message, FName & rule_id, const UClass * asset_class, const FAssetData & asset_data, const FNamingConventionAssetBatchVerdicts * batch_verdicts, FNamingConventionValidationBudget * validation_budget ) const
+{
+    // The precomputed verdicts can only be used if they were evaluated with the class the asset resolved to
+    if ( batch_verdicts != nullptr && batch_verdicts->AssetClass != asset_class )
+    {
+        batch_verdicts = nullptr;
+    }
+
+    for ( auto sorted_validator_index = 0; sorted_validator_index < SortedValidators.Num(); ++sorted_validator_index )
+    {
+        auto * validator = SortedValidators[ sorted_validator_index ];
+        if ( !validator->IsEnabled() )
+        {
+            continue;
+        }
+
+        const auto thread_safe_validator_index = SortedValidatorThreadSafeIndices[ sorted_validator_index ];
+        const auto has_batch_verdict = thread_safe_validator_index != INDEX_NONE
+                                       && batch_verdicts != nullptr
+                                       && batch_verdicts->Verdicts.IsValidIndex( thread_safe_validator_index )
+                                       && ( batch_verdicts->DisabledValidators == nullptr || !( *batch_verdicts->DisabledValidators )[ thread_safe_validator_index ] );
+
+        // The validators the budget disabled are only skipped when they would have to be called, and would handle the asset
+        if ( !has_batch_verdict && validation_budget != nullptr && validation_budget->IsValidatorDisabled( validator ) )
+        {
+            if ( validator->CanValidateAssetNaming( asset_class, asset_data ) )
+            {
+                validation_budget->AddSkippedValidator( validator );
+            }
+            continue;
+        }
+
+        const auto start_cycles = FPlatformTime::Cycles64();
+        const auto add_call_time = [ & ]() {
+            if ( validation_budget != nullptr )
+            {
+                validation_budget->AddValidatorCall( validator, FPlatformTime::ToSeconds64( FPlatformTime::Cycles64() - start_cycles ) );
+            }
+        };
+
+        if ( thread_safe_validator_index != INDEX_NONE )
+        {
+            auto verdict = FNamingConventionNativeVerdict();
+            if ( has_batch_verdict )
+            {
+                verdict = batch_verdicts->Verdicts[ thread_safe_validator_index ];
             }
+            else
+            {
+                verdict = ValidateAssetNamingThreadSafe( *validator, asset_class, asset_data );
+                add_call_time();
+            }
+
+            // Unknown means the validator does not handle the asset, like CanValidateAssetNaming returning false
+            if ( verdict.Result != ENamingConventionValidationResult::Valid && verdict.Result != ENamingConventionValidationResult::Unknown )
+            {
+                error_message = GetThreadSafeVerdictMessage( *validator, asset_class, asset_data, verdict );
+                rule_id = FName( *validator->GetClass()->GetPathName() );
+                return verdict.Result;
+            }
+
+            continue;
+        }
+
+        // CanValidateAssetNaming is timed too, since it runs for every asset
+        auto result = ENamingConventionValidationResult::Valid;
+        if ( validator->CanValidateAssetNaming( asset_class, asset_data ) )
+        {
+            result = validator->ValidateAssetNaming( error_message, asset_class, asset_data );
+        }
+
+        add_call_time();
+
+        if ( result != ENamingConventionValidationResult::Valid )
+        {
+            rule_id = FName( *validator->GetClass()->GetPathName() );
+            return result;
         }
     }
 
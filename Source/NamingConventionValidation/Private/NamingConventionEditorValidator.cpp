@@ -0,0 +1,48 @@
+#include "NamingConventionEditorValidator.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationSettings.h"
+
+#include <Editor.h>
+
+#define LOCTEXT_NAMESPACE "NamingConventionValidationManager"
+
+bool UNamingConventionEditorValidator::CanValidateAsset_Implementation( const FAssetData & /*asset_data*/, UObject * asset, FDataValidationContext & /*context*/ ) const
+{
+    return asset != nullptr
+           && GetDefault< UNamingConventionValidationSettings >()->bValidateWithDataValidation
+           && GEditor != nullptr
+           && GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() != nullptr;
+}
+
+EDataValidationResult UNamingConventionEditorValidator::ValidateLoadedAsset_Implementation( const FAssetData & asset_data, UObject * asset, FDataValidationContext & /*context*/ )
+{
+    // The registry data has the tags used to find the native class of blueprints
+    const auto registry_asset_data = asset_data.IsValid() ? asset_data : FAssetData( asset );
+
+    const auto * editor_validation_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
+
+    FText error_message;
+    FName rule_id;
+
+    // Like the other validations, the verdict is stored for the content browser filter
+    switch ( editor_validation_subsystem->ValidateAsset( error_message, rule_id, registry_asset_data ) )
+    {
+        case ENamingConventionValidationResult::Invalid:
+        {
+            AssetFails( asset, FText::Format( LOCTEXT( "DataValidationNamingError", "{0} does not match naming convention. {1}" ), FText::FromName( registry_asset_data.AssetName ), error_message ) );
+            return EDataValidationResult::Invalid;
+        }
+        case ENamingConventionValidationResult::Valid:
+        {
+            AssetPasses( asset );
+            return EDataValidationResult::Valid;
+        }
+        default:
+        {
+            return EDataValidationResult::NotValidated;
+        }
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
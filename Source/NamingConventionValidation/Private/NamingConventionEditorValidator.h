@@ -0,0 +1,18 @@
+#pragma once
+
+#include <CoreMinimal.h>
+#include <EditorValidatorBase.h>
+
+#include "NamingConventionEditorValidator.generated.h"
+
+// Runs the naming convention validation during the validation pass of the Data Validation plugin, with the rules of UEditorNamingValidatorSubsystem.
+// The naming errors are then part of the Data Validation report, without having to run another commandlet
+UCLASS()
+class UNamingConventionEditorValidator final : public UEditorValidatorBase
+{
+    GENERATED_BODY()
+
+public:
+    bool CanValidateAsset_Implementation( const FAssetData & asset_data, UObject * asset, FDataValidationContext & context ) const override;
+    EDataValidationResult ValidateLoadedAsset_Implementation( const FAssetData & asset_data, UObject * asset, FDataValidationContext & context ) override;
+};
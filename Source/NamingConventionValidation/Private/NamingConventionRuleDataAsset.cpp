@@ -0,0 +1,212 @@
+#include "NamingConventionRuleDataAsset.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationLog.h"
+
+#include <Algo/BinarySearch.h>
+#include <Editor.h>
+#include <String/Find.h>
+
+#define LOCTEXT_NAMESPACE "NamingConventionValidationManager"
+
+namespace
+{
+    // Token counts above this are rare, and only make the split allocate
+    typedef TArray< FStringView, TInlineAllocator< 16 > > FNameTokens;
+
+    void SplitIntoTokens( FNameTokens & tokens, FStringView view, const FStringView separator )
+    {
+        if ( separator.IsEmpty() )
+        {
+            tokens.Add( view );
+            return;
+        }
+
+        while ( !view.IsEmpty() )
+        {
+            const auto separator_index = UE::String::FindFirst( view, separator, ESearchCase::CaseSensitive );
+            if ( separator_index == INDEX_NONE )
+            {
+                tokens.Add( view );
+                break;
+            }
+
+            if ( separator_index > 0 )
+            {
+                tokens.Add( view.Left( separator_index ) );
+            }
+
+            view.RightChopInline( separator_index + separator.Len() );
+        }
+    }
+}
+
+UNamingConventionRuleDataAsset::UNamingConventionRuleDataAsset() :
+    bIsEnabled( true ),
+    TokenSeparator( TEXT( "_" ) )
+{
+    AllowedAsciiCharacters[ 0 ] = 0;
+    AllowedAsciiCharacters[ 1 ] = 0;
+}
+
+void UNamingConventionRuleDataAsset::CompileRule()
+{
+    RuleId = FName( *FString::Printf( TEXT( "Rule.%s" ), *GetPathName() ) );
+
+    // The blueprint classes are not loaded: an asset can only derive from a class which is loaded with its own class
+    ClassPaths.Reset( Classes.Num() );
+    for ( const auto & class_path : Classes )
+    {
+        const auto asset_path = class_path.ToSoftObjectPath().GetAssetPath();
+        UE_CLOG( !asset_path.IsValid(), LogNamingConventionValidation, Warning, TEXT( "Impossible to get a valid class path for %s in the rule %s" ), *class_path.ToString(), *GetPathName() );
+
+        if ( asset_path.IsValid() )
+        {
+            ClassPaths.AddUnique( asset_path );
+        }
+    }
+
+    // The trailing slash prevents /Game/Foo from matching /Game/FooBar
+    FolderPrefixes.Reset( Folders.Num() );
+    for ( const auto & folder : Folders )
+    {
+        if ( !folder.Path.IsEmpty() )
+        {
+            FolderPrefixes.Add( folder.Path.EndsWith( TEXT( "/" ) ) ? folder.Path : folder.Path + TEXT( "/" ) );
+        }
+    }
+
+    AllowedAsciiCharacters[ 0 ] = 0;
+    AllowedAsciiCharacters[ 1 ] = 0;
+    AllowedNonAsciiCharacters.Reset();
+
+    for ( const auto character : AllowedCharacters )
+    {
+        if ( character < 128 )
+        {
+            AllowedAsciiCharacters[ character >> 6 ] |= 1ull << ( character & 63 );
+        }
+        else
+        {
+            AllowedNonAsciiCharacters.AddUnique( character );
+        }
+    }
+
+    AllowedNonAsciiCharacters.Sort();
+}
+
+bool UNamingConventionRuleDataAsset::IsEnabled() const
+{
+    return bIsEnabled;
+}
+
+FName UNamingConventionRuleDataAsset::GetRuleId() const
+{
+    return RuleId;
+}
+
+const TArray< FTopLevelAssetPath > & UNamingConventionRuleDataAsset::GetClassPaths() const
+{
+    return ClassPaths;
+}
+
+ENamingConventionValidationResult UNamingConventionRuleDataAsset::ValidateAssetName( FText & error_message, const UClass * asset_class, const FStringView package_path, const FStringView asset_name ) const
+{
+    if ( !FolderPrefixes.IsEmpty() )
+    {
+        TStringBuilder< 256 > folder;
+        folder << package_path << TEXT( '/' );
+
+        if ( !FolderPrefixes.ContainsByPredicate( [ &folder ]( const FString & folder_prefix ) {
+                 return folder.ToView().StartsWith( folder_prefix );
+             } ) )
+        {
+            return ENamingConventionValidationResult::Unknown;
+        }
+    }
+
+    if ( !ClassPaths.IsEmpty() )
+    {
+        auto it_matches_class = false;
+        for ( const auto * super_class = asset_class; super_class != nullptr && !it_matches_class; super_class = super_class->GetSuperClass() )
+        {
+            it_matches_class = ClassPaths.Contains( super_class->GetClassPathName() );
+        }
+
+        if ( !it_matches_class )
+        {
+            return ENamingConventionValidationResult::Unknown;
+        }
+    }
+
+    if ( !AllowedCharacters.IsEmpty() )
+    {
+        for ( const auto character : asset_name )
+        {
+            if ( !IsCharacterAllowed( character ) )
+            {
+                error_message = FText::Format( LOCTEXT( "RuleForbiddenCharacter", "The character '{0}' is not allowed by the rule {1}. Allowed characters: {2}" ), FText::FromString( FString::Chr( character ) ), FText::FromString( GetName() ), FText::FromString( AllowedCharacters ) );
+                return ENamingConventionValidationResult::Invalid;
+            }
+        }
+    }
+
+    if ( !TokenConstraints.IsEmpty() )
+    {
+        FNameTokens tokens;
+        SplitIntoTokens( tokens, asset_name, TokenSeparator );
+
+        for ( const auto & token_constraint : TokenConstraints )
+        {
+            const auto token_index = token_constraint.Position >= 0 ? token_constraint.Position : tokens.Num() + token_constraint.Position;
+
+            if ( !tokens.IsValidIndex( token_index ) )
+            {
+                error_message = FText::Format( LOCTEXT( "RuleMissingToken", "The asset name must have a token at position {0}, as required by the rule {1}" ), token_constraint.Position, FText::FromString( GetName() ) );
+                return ENamingConventionValidationResult::Invalid;
+            }
+
+            if ( token_constraint.AllowedTokens.IsEmpty() )
+            {
+                continue;
+            }
+
+            const auto search_case = token_constraint.bIsCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase;
+            const auto token = tokens[ token_index ];
+
+            if ( !token_constraint.AllowedTokens.ContainsByPredicate( [ token, search_case ]( const FString & allowed_token ) {
+                     return token.Equals( allowed_token, search_case );
+                 } ) )
+            {
+                error_message = FText::Format( LOCTEXT( "RuleWrongToken", "The token at position {0} of the asset name must be one of {1}, as required by the rule {2}" ), token_constraint.Position, FText::FromString( FString::Join( token_constraint.AllowedTokens, TEXT( ", " ) ) ), FText::FromString( GetName() ) );
+                return ENamingConventionValidationResult::Invalid;
+            }
+        }
+    }
+
+    return ENamingConventionValidationResult::Valid;
+}
+
+#if WITH_EDITOR
+void UNamingConventionRuleDataAsset::PostEditChangeProperty( FPropertyChangedEvent & property_changed_event )
+{
+    Super::PostEditChangeProperty( property_changed_event );
+
+    if ( auto * editor_validation_subsystem = GEditor != nullptr ? GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() : nullptr )
+    {
+        editor_validation_subsystem->RegisterRule( this );
+    }
+}
+#endif
+
+bool UNamingConventionRuleDataAsset::IsCharacterAllowed( const TCHAR character ) const
+{
+    if ( character < 128 )
+    {
+        return ( AllowedAsciiCharacters[ character >> 6 ] & ( 1ull << ( character & 63 ) ) ) != 0;
+    }
+
+    return Algo::BinarySearch( AllowedNonAsciiCharacters, character ) != INDEX_NONE;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,82 @@
+#include "NamingConventionValidationAsyncAction.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationRun.h"
+
+#include <Editor.h>
+
+UNamingConventionValidationAsyncAction * UNamingConventionValidationAsyncAction::ValidateAssetsAsync( const TArray< FAssetData > & assets, const bool report_to_message_log )
+{
+    auto * action = NewObject< UNamingConventionValidationAsyncAction >();
+    action->Assets = assets;
+    action->ItReportsToMessageLog = report_to_message_log;
+    return action;
+}
+
+UNamingConventionValidationAsyncAction * UNamingConventionValidationAsyncAction::ValidatePathsAsync( const TArray< FString > & paths, const bool report_to_message_log )
+{
+    auto * action = NewObject< UNamingConventionValidationAsyncAction >();
+    action->Paths = paths;
+    action->ItReportsToMessageLog = report_to_message_log;
+    return action;
+}
+
+void UNamingConventionValidationAsyncAction::Activate()
+{
+    auto * editor_validation_subsystem = GEditor != nullptr ? GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() : nullptr;
+    if ( editor_validation_subsystem == nullptr )
+    {
+        OnCompleted.Broadcast( 0, true );
+        SetReadyToDestroy();
+        return;
+    }
+
+    if ( !Paths.IsEmpty() )
+    {
+        editor_validation_subsystem->GetAssetsToValidate( Assets, Paths );
+        Paths.Empty();
+    }
+
+    editor_validation_subsystem->AddActiveAsyncAction( this );
+
+    const auto run = editor_validation_subsystem->ValidateAssetsInBackground( MoveTemp( Assets ), ItReportsToMessageLog );
+    run->SetReportsToMessageLog( ItReportsToMessageLog );
+
+    TWeakObjectPtr< UNamingConventionValidationAsyncAction > weak_this( this );
+    TWeakObjectPtr< UEditorNamingValidatorSubsystem > weak_subsystem( editor_validation_subsystem );
+
+    run->SetOnVerdicts( [ weak_this ]( const TConstArrayView< FNamingConventionValidationVerdict > verdicts ) {
+        if ( weak_this.IsValid() && weak_this->OnVerdicts.IsBound() )
+        {
+            weak_this->OnVerdicts.Broadcast( TArray< FNamingConventionValidationVerdict >( verdicts ) );
+        }
+    } );
+    run->SetOnProgress( [ weak_this ]( const int32 processed_count, const int32 total_count ) {
+        if ( weak_this.IsValid() )
+        {
+            weak_this->OnProgress.Broadcast( processed_count, total_count );
+        }
+    } );
+    run->SetOnFinished( [ weak_this, weak_subsystem ]( const int32 invalid_count, const bool was_cancelled ) {
+        if ( weak_this.IsValid() )
+        {
+            weak_this->OnCompleted.Broadcast( invalid_count, was_cancelled );
+            weak_this->SetReadyToDestroy();
+
+            if ( weak_subsystem.IsValid() )
+            {
+                weak_subsystem->RemoveActiveAsyncAction( weak_this.Get() );
+            }
+        }
+    } );
+
+    Run = run;
+}
+
+void UNamingConventionValidationAsyncAction::Cancel()
+{
+    if ( const auto run = Run.Pin() )
+    {
+        run->Cancel();
+    }
+}
@@ -0,0 +1,275 @@
+#include "NamingConventionValidationBaseline.h"
+
+#include "NamingConventionValidationLog.h"
+
+#include <Algo/BinarySearch.h>
+#include <Async/MappedFileHandle.h>
+#include <HAL/FileManager.h>
+#include <HAL/PlatformFileManager.h>
+#include <Hash/CityHash.h>
+#include <Misc/FileHelper.h>
+
+// "NCVB"
+const uint32 FNamingConventionValidationBaseline::FileMagic = 0x4E435642;
+const uint32 FNamingConventionValidationBaseline::FileVersion = 1;
+
+FNamingConventionValidationBaseline::FNamingConventionValidationBaseline() :
+    Strings( nullptr ),
+    StringsSize( 0 ),
+    KnownViolationCount( 0 ),
+    NewViolationCount( 0 )
+{
+}
+
+FNamingConventionValidationBaseline::~FNamingConventionValidationBaseline()
+{
+    Unload();
+}
+
+bool FNamingConventionValidationBaseline::Load( const FString & file_path )
+{
+    Unload();
+
+    auto & platform_file = FPlatformFileManager::Get().GetPlatformFile();
+    if ( !platform_file.FileExists( *file_path ) )
+    {
+        return false;
+    }
+
+    MappedFile.Reset( platform_file.OpenMapped( *file_path ) );
+    if ( MappedFile.IsValid() )
+    {
+        MappedRegion.Reset( MappedFile->MapRegion() );
+    }
+
+    auto is_loaded = false;
+
+    if ( MappedRegion.IsValid() )
+    {
+        is_loaded = BindData( MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize() );
+    }
+    else if ( FFileHelper::LoadFileToArray( FileData, *file_path ) )
+    {
+        is_loaded = BindData( FileData.GetData(), FileData.Num() );
+    }
+
+    if ( !is_loaded )
+    {
+        UE_LOG( LogNamingConventionValidation, Warning, TEXT( "The file %s is not a valid naming convention baseline" ), *file_path );
+        Unload();
+    }
+
+    return is_loaded;
+}
+
+bool FNamingConventionValidationBaseline::Save( const FString & file_path, const TArrayView< const FString > validated_paths )
+{
+    TArray< FString > keys;
+
+    if ( IsLoaded() )
+    {
+        for ( auto index = 0; index < Hashes.Num(); ++index )
+        {
+            if ( RecordedEntries[ index ] || !IsEntryInPaths( index, validated_paths ) )
+            {
+                keys.Emplace( UTF8_TO_TCHAR( GetEntryKey( index ) ) );
+            }
+        }
+    }
+    else
+    {
+        keys = RecordedViolations.Array();
+    }
+
+    // The file may be the one currently mapped
+    Unload();
+
+    TArray< ANSICHAR > strings;
+    TArray< uint32 > key_offsets;
+    TArray< TPair< uint64, int32 > > sorted_keys;
+    key_offsets.Reserve( keys.Num() );
+    sorted_keys.Reserve( keys.Num() );
+
+    for ( auto index = 0; index < keys.Num(); ++index )
+    {
+        const FTCHARToUTF8 utf8_key( *keys[ index ] );
+
+        key_offsets.Add( strings.Num() );
+        strings.Append( utf8_key.Get(), utf8_key.Length() );
+        strings.Add( '\0' );
+        sorted_keys.Emplace( HashKey( utf8_key ), index );
+    }
+
+    sorted_keys.Sort( []( const auto & first, const auto & second ) {
+        return first.Key < second.Key;
+    } );
+
+    TArray< uint64 > hashes;
+    TArray< uint32 > string_offsets;
+    hashes.Reserve( sorted_keys.Num() );
+    string_offsets.Reserve( sorted_keys.Num() );
+
+    for ( const auto & sorted_key : sorted_keys )
+    {
+        hashes.Add( sorted_key.Key );
+        string_offsets.Add( key_offsets[ sorted_key.Value ] );
+    }
+
+    const TUniquePtr< FArchive > writer( IFileManager::Get().CreateFileWriter( *file_path ) );
+    if ( !writer.IsValid() )
+    {
+        UE_LOG( LogNamingConventionValidation, Error, TEXT( "Impossible to write the naming convention baseline %s" ), *file_path );
+        return false;
+    }
+
+    FHeader header { FileMagic, FileVersion, static_cast< uint32 >( hashes.Num() ), static_cast< uint32 >( strings.Num() ) };
+
+    writer->Serialize( &header, sizeof( header ) );
+    writer->Serialize( hashes.GetData(), hashes.Num() * sizeof( uint64 ) );
+    writer->Serialize( string_offsets.GetData(), string_offsets.Num() * sizeof( uint32 ) );
+    writer->Serialize( strings.GetData(), strings.Num() );
+
+    return writer->Close();
+}
+
+bool FNamingConventionValidationBaseline::RecordViolation( const FName package_name, const FName rule_id )
+{
+    const auto key = MakeKey( package_name, rule_id );
+
+    if ( !IsLoaded() )
+    {
+        RecordedViolations.Add( key );
+        ++NewViolationCount;
+        return false;
+    }
+
+    const FTCHARToUTF8 utf8_key( *key );
+    const auto hash = HashKey( utf8_key );
+
+    // Different keys could share the same hash, so all the entries with this hash must be compared
+    for ( auto index = Algo::LowerBound( Hashes, hash ); index < Hashes.Num() && Hashes[ index ] == hash; ++index )
+    {
+        if ( FCStringAnsi::Strcmp( GetEntryKey( index ), utf8_key.Get() ) == 0 )
+        {
+            RecordedEntries[ index ] = true;
+            ++KnownViolationCount;
+            return true;
+        }
+    }
+
+    ++NewViolationCount;
+    return false;
+}
+
+bool FNamingConventionValidationBaseline::IsLoaded() const
+{
+    return Strings != nullptr;
+}
+
+int32 FNamingConventionValidationBaseline::Num() const
+{
+    return Hashes.Num();
+}
+
+int32 FNamingConventionValidationBaseline::GetKnownViolationCount() const
+{
+    return KnownViolationCount;
+}
+
+int32 FNamingConventionValidationBaseline::GetNewViolationCount() const
+{
+    return NewViolationCount;
+}
+
+int32 FNamingConventionValidationBaseline::GetFixedViolationCount( const TArrayView< const FString > validated_paths ) const
+{
+    auto fixed_violation_count = 0;
+
+    for ( auto index = 0; index < Hashes.Num(); ++index )
+    {
+        if ( !RecordedEntries[ index ] && IsEntryInPaths( index, validated_paths ) )
+        {
+            ++fixed_violation_count;
+        }
+    }
+
+    return fixed_violation_count;
+}
+
+FString FNamingConventionValidationBaseline::MakeKey( const FName package_name, const FName rule_id )
+{
+    return FString::Printf( TEXT( "%s\t%s" ), *package_name.ToString(), *rule_id.ToString() ).ToLower();
+}
+
+uint64 FNamingConventionValidationBaseline::HashKey( const FTCHARToUTF8 & key )
+{
+    return CityHash64( key.Get(), key.Length() );
+}
+
+bool FNamingConventionValidationBaseline::BindData( const uint8 * data, const int64 size )
+{
+    if ( size < static_cast< int64 >( sizeof( FHeader ) ) )
+    {
+        return false;
+    }
+
+    FHeader header;
+    FMemory::Memcpy( &header, data, sizeof( FHeader ) );
+
+    if ( header.Magic != FileMagic || header.Version != FileVersion )
+    {
+        return false;
+    }
+
+    const int64 hashes_offset = sizeof( FHeader );
+    const int64 string_offsets_offset = hashes_offset + static_cast< int64 >( header.EntryCount ) * sizeof( uint64 );
+    const int64 strings_offset = string_offsets_offset + static_cast< int64 >( header.EntryCount ) * sizeof( uint32 );
+
+    if ( strings_offset + header.StringsSize != size || ( header.StringsSize > 0 && data[ size - 1 ] != '\0' ) )
+    {
+        return false;
+    }
+
+    Hashes = TArrayView< const uint64 >( reinterpret_cast< const uint64 * >( data + hashes_offset ), header.EntryCount );
+    StringOffsets = TArrayView< const uint32 >( reinterpret_cast< const uint32 * >( data + string_offsets_offset ), header.EntryCount );
+    Strings = reinterpret_cast< const ANSICHAR * >( data + strings_offset );
+    StringsSize = header.StringsSize;
+
+    for ( const auto string_offset : StringOffsets )
+    {
+        if ( string_offset >= StringsSize )
+        {
+            return false;
+        }
+    }
+
+    RecordedEntries.Init( false, header.EntryCount );
+    return true;
+}
+
+void FNamingConventionValidationBaseline::Unload()
+{
+    Hashes = TArrayView< const uint64 >();
+    StringOffsets = TArrayView< const uint32 >();
+    Strings = nullptr;
+    StringsSize = 0;
+    RecordedEntries.Empty();
+
+    MappedRegion.Reset();
+    MappedFile.Reset();
+    FileData.Empty();
+}
+
+const ANSICHAR * FNamingConventionValidationBaseline::GetEntryKey( const int32 index ) const
+{
+    return Strings + StringOffsets[ index ];
+}
+
+bool FNamingConventionValidationBaseline::IsEntryInPaths( const int32 index, const TArrayView< const FString > paths ) const
+{
+    const FString entry_key( UTF8_TO_TCHAR( GetEntryKey( index ) ) );
+
+    return paths.ContainsByPredicate( [ &entry_key ]( const auto & path ) {
+        return entry_key.StartsWith( path.EndsWith( TEXT( "/" ) ) ? path : path + TEXT( "/" ) );
+    } );
+}
@@ -0,0 +1,100 @@
+#include "NamingConventionValidationBudget.h"
+
+#include "EditorNamingValidatorBase.h"
+#include "NamingConventionValidationLog.h"
+#include "NamingConventionValidationSettings.h"
+
+FNamingConventionValidationBudget::FNamingConventionValidationBudget()
+{
+    Reset();
+}
+
+void FNamingConventionValidationBudget::Reset()
+{
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+    ValidatorTimings.Reset();
+    SkippedValidators.Reset();
+    CallTimeBudget = settings->ValidatorCallTimeBudgetMs / 1000.0;
+    RunTimeBudget = settings->ValidatorRunTimeBudgetMs / 1000.0;
+    ItHasDisabledValidators = false;
+}
+
+bool FNamingConventionValidationBudget::IsValidatorDisabled( const UEditorNamingValidatorBase * validator ) const
+{
+    if ( !ItHasDisabledValidators )
+    {
+        return false;
+    }
+
+    const auto * timing = ValidatorTimings.Find( validator );
+    return timing != nullptr && timing->ItIsDisabled;
+}
+
+void FNamingConventionValidationBudget::AddValidatorCall( const UEditorNamingValidatorBase * validator, const double call_seconds )
+{
+    auto & timing = ValidatorTimings.FindOrAdd( validator );
+    timing.TotalSeconds += call_seconds;
+    timing.MaxCallSeconds = FMath::Max( timing.MaxCallSeconds, call_seconds );
+    ++timing.CallCount;
+
+    if ( timing.ItIsDisabled )
+    {
+        return;
+    }
+
+    const auto exceeds_call_budget = CallTimeBudget > 0.0 && call_seconds > CallTimeBudget;
+    const auto exceeds_run_budget = RunTimeBudget > 0.0 && timing.TotalSeconds > RunTimeBudget;
+
+    if ( exceeds_call_budget || exceeds_run_budget )
+    {
+        timing.ItIsDisabled = true;
+        ItHasDisabledValidators = true;
+
+        UE_LOG( LogNamingConventionValidation, Warning, TEXT( "The naming convention validator %s is disabled until the end of the validation : %s (%.1f ms for the last call, %.1f ms for %i calls)" ),
+            *validator->GetClass()->GetPathName(),
+            exceeds_call_budget ? TEXT( "a call exceeded the budget" ) : TEXT( "its total time exceeded the budget" ),
+            call_seconds * 1000.0,
+            timing.TotalSeconds * 1000.0,
+            timing.CallCount );
+    }
+}
+
+void FNamingConventionValidationBudget::BeginAsset()
+{
+    SkippedValidators.Reset();
+}
+
+void FNamingConventionValidationBudget::AddSkippedValidator( const UEditorNamingValidatorBase * validator )
+{
+    SkippedValidators.Add( validator );
+    ++ValidatorTimings.FindOrAdd( validator ).SkippedCount;
+}
+
+TConstArrayView< const UEditorNamingValidatorBase * > FNamingConventionValidationBudget::GetSkippedValidators() const
+{
+    return SkippedValidators;
+}
+
+bool FNamingConventionValidationBudget::HasDisabledValidators() const
+{
+    return ItHasDisabledValidators;
+}
+
+void FNamingConventionValidationBudget::GetReportLines( TArray< FString > & lines ) const
+{
+    for ( const auto & [ validator, timing ] : ValidatorTimings )
+    {
+        if ( timing.ItIsDisabled )
+        {
+            lines.Add( FString::Printf( TEXT( "%s was disabled for exceeding its time budget : %i calls, %.1f ms in total, %.1f ms for the slowest call, %i assets not evaluated" ),
+                *validator->GetClass()->GetPathName(),
+                timing.CallCount,
+                timing.TotalSeconds * 1000.0,
+                timing.MaxCallSeconds * 1000.0,
+                timing.SkippedCount ) );
+        }
+    }
+
+    lines.Sort();
+}
@@ -2,11 +2,18 @@
 
 #include "NamingConventionValidationLog.h"
 #include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationBaseline.h"
+#include "NamingConventionValidationCompiledMatcher.h"
+#include "NamingConventionValidationDaemon.h"
+#include "NamingConventionValidationMemory.h"
+#include "NamingConventionValidationSettings.h"
 
 #include <Editor.h>
 #include <AssetRegistry/AssetRegistryHelpers.h>
 #include <AssetRegistry/AssetRegistryModule.h>
 #include <AssetRegistry/IAssetRegistry.h>
+#include <Misc/ConfigCacheIni.h>
+#include <Misc/Paths.h>
 
 UNamingConventionValidationCommandlet::UNamingConventionValidationCommandlet()
 {
@@ -15,6 +22,8 @@ UNamingConventionValidationCommandlet::UNamingConventionValidationCommandlet()
 
 int32 UNamingConventionValidationCommandlet::Main( const FString & params )
 {
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
     UE_LOG( LogNamingConventionValidation, Log, TEXT( "--------------------------------------------------------------------------------------------" ) );
     UE_LOG( LogNamingConventionValidation, Log, TEXT( "Running NamingConventionValidation Commandlet" ) );
     TArray< FString > tokens;
@@ -22,6 +31,31 @@ int32 UNamingConventionValidationCommandlet::Main( const FString & params )
     TMap< FString, FString > params_map;
     ParseCommandLine( *params, tokens, switches, params_map );
 
+    // -Daemon keeps the editor loaded and answers the validation requests of local clients, on -DaemonPort=<port>
+    if ( switches.Contains( TEXT( "Daemon" ) ) )
+    {
+        auto port = DefaultDaemonPort;
+        if ( const auto * daemon_port = params_map.Find( TEXT( "DaemonPort" ) ) )
+        {
+            port = FCString::Atoi( **daemon_port );
+        }
+
+        return RunDaemon( port ) ? 0 : 2;
+    }
+
+    // -WhatIf=<ini file> reports the assets which would start or stop failing with the settings of the file, in place of validating them
+    if ( const auto * what_if = params_map.Find( TEXT( "WhatIf" ) ) )
+    {
+        return AnalyzeSettingsImpact( *what_if ) ? 0 : 2;
+    }
+
+    // -GenerateMatcher=<module directory> writes the module of the compiled matcher, named -MatcherModuleName=<name>, in place of validating the assets
+    if ( const auto * generate_matcher = params_map.Find( TEXT( "GenerateMatcher" ) ) )
+    {
+        const auto * matcher_module_name = params_map.Find( TEXT( "MatcherModuleName" ) );
+        return GenerateMatcher( *generate_matcher, matcher_module_name != nullptr ? *matcher_module_name : FString( DefaultMatcherModuleName ) ) ? 0 : 2;
+    }
+
     TArray< FString > paths;
     if ( const auto * path = params_map.Find( TEXT( "Paths" ) ) ) 
     {
@@ -32,8 +66,33 @@ int32 UNamingConventionValidationCommandlet::Main( const FString & params )
         paths.Add( TEXT( "/Game" ) );
     }
 
+    // -BenchmarkMatcher times the matching of the names of the assets of the paths, -BenchmarkIterations=<count> times, in place of validating them
+    if ( switches.Contains( TEXT( "BenchmarkMatcher" ) ) )
+    {
+        auto iteration_count = DefaultBenchmarkIterationCount;
+        if ( const auto * benchmark_iterations = params_map.Find( TEXT( "BenchmarkIterations" ) ) )
+        {
+            iteration_count = FMath::Max( FCString::Atoi( **benchmark_iterations ), 1 );
+        }
+
+        return BenchmarkMatcher( paths, iteration_count ) ? 0 : 2;
+    }
+
+    // -Baseline=<file> only fails on the violations which are not in the file. -UpdateBaseline removes the fixed violations from the file, or creates it
+    FString baseline_file_path;
+    if ( const auto * baseline = params_map.Find( TEXT( "Baseline" ) ) )
+    {
+        baseline_file_path = *baseline;
+    }
+
+    const auto update_baseline = switches.Contains( TEXT( "UpdateBaseline" ) );
+
+    // -ValidateWhileScanning overlaps the scan of the paths with the validation of the assets already discovered.
+    // It scans the whole project, so it is best suited to validating most of it
+    const auto validate_while_scanning = switches.Contains( TEXT( "ValidateWhileScanning" ) );
+
     // validate data
-    if ( !ValidateData( paths ) )
+    if ( !ValidateData( paths, baseline_file_path, update_baseline, validate_while_scanning ) )
     {
         UE_LOG( LogNamingConventionValidation, Warning, TEXT( "Errors occurred while validating naming convention" ) );
         return 2; // return something other than 1 for error since the engine will return 1 if any other system (possibly unrelated) logged errors during execution.
@@ -45,23 +104,168 @@ int32 UNamingConventionValidationCommandlet::Main( const FString & params )
 }
 
 //static
-bool UNamingConventionValidationCommandlet::ValidateData( TArrayView< FString > paths )
+bool UNamingConventionValidationCommandlet::RunDaemon( const int32 port )
+{
+    FNamingConventionValidationDaemon daemon( port );
+    if ( !daemon.Start() )
+    {
+        return false;
+    }
+
+    daemon.Run();
+    return true;
+}
+
+//static
+bool UNamingConventionValidationCommandlet::AnalyzeSettingsImpact( const FString & candidate_settings_file_path )
 {
+    const auto config_file_path = FConfigCacheIni::NormalizeConfigIniPath( candidate_settings_file_path );
+    if ( !FPaths::FileExists( config_file_path ) )
+    {
+        UE_LOG( LogNamingConventionValidation, Error, TEXT( "No candidate settings found at %s" ), *config_file_path );
+        return false;
+    }
+
     const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName );
-    asset_registry_module.Get().ScanPathsSynchronous( TArray< FString >( paths ), true );
+    asset_registry_module.Get().SearchAllAssets( true );
 
-    TArray< FAssetData > asset_data_list;
+    auto * editor_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
+    check( editor_validator_subsystem );
 
-    FARFilter filter;
-    filter.bRecursivePaths = true;
-    filter.PackagePaths.Append( paths );
-    asset_registry_module.Get().GetAssets( filter, asset_data_list );
+    // A new object starts from the current settings, so the properties the file does not set keep their current values
+    auto * candidate_settings = NewObject< UNamingConventionValidationSettings >( GetTransientPackage(), NAME_None, RF_Transient );
+    GConfig->LoadFile( config_file_path );
+    candidate_settings->LoadConfig( nullptr, *config_file_path );
+    candidate_settings->PostProcessSettings();
 
+    FNamingConventionSettingsImpact impact;
+    if ( !editor_validator_subsystem->AnalyzeSettingsImpact( impact, *candidate_settings ) )
+    {
+        return false;
+    }
+
+    TArray< FString > lines;
+    impact.GetReportLines( lines );
+
+    for ( const auto & line : lines )
+    {
+        UE_LOG( LogNamingConventionValidation, Display, TEXT( "%s" ), *line );
+    }
+
+    for ( const auto & change : impact.Changes )
+    {
+        UE_LOG( LogNamingConventionValidation, Log, TEXT( "%s" ), *change.ToString() );
+    }
+
+    return true;
+}
+
+//static
+bool UNamingConventionValidationCommandlet::ValidateData( TArrayView< FString > paths, const FString & baseline_file_path, const bool update_baseline, const bool validate_while_scanning )
+{
     const auto * editor_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
     check( editor_validator_subsystem );
 
-    // ReSharper disable once CppExpressionWithoutSideEffects
-    editor_validator_subsystem->ValidateAssets( asset_data_list );
+    const auto validate_assets = [ & ]( FNamingConventionValidationBaseline * baseline ) {
+        if ( validate_while_scanning )
+        {
+            return editor_validator_subsystem->ValidateAssetsWhileScanning( paths, baseline );
+        }
+
+        const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName );
+        asset_registry_module.Get().ScanPathsSynchronous( TArray< FString >( paths ), true );
+
+        TArray< FAssetData > asset_data_list;
+        editor_validator_subsystem->GetAssetsToValidate( asset_data_list, paths );
+
+        return baseline != nullptr
+                   ? editor_validator_subsystem->ValidateAssetsWithBaseline( asset_data_list, *baseline )
+                   : editor_validator_subsystem->ValidateAssets( asset_data_list );
+    };
+
+    if ( baseline_file_path.IsEmpty() )
+    {
+        // ReSharper disable once CppExpressionWithoutSideEffects
+        validate_assets( nullptr );
+
+        return true;
+    }
+
+    FNamingConventionValidationBaseline baseline;
+    const auto has_loaded_baseline = baseline.Load( baseline_file_path );
+
+    UE_CLOG( !has_loaded_baseline, LogNamingConventionValidation, Display, TEXT( "No naming convention baseline found at %s, all the violations are new" ), *baseline_file_path );
+
+    const auto new_violation_count = validate_assets( &baseline );
+    const auto fixed_violation_count = baseline.GetFixedViolationCount( paths );
+
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "Baseline : %i known violations, %i new violations, %i fixed violations" ), baseline.GetKnownViolationCount(), new_violation_count, fixed_violation_count );
+
+    if ( update_baseline )
+    {
+        if ( !baseline.Save( baseline_file_path, paths ) )
+        {
+            return false;
+        }
+
+        UE_LOG( LogNamingConventionValidation, Display, TEXT( "Updated the naming convention baseline %s" ), *baseline_file_path );
+
+        // Creating the baseline accepts all the current violations
+        if ( !has_loaded_baseline )
+        {
+            return true;
+        }
+    }
+    else
+    {
+        UE_CLOG( fixed_violation_count > 0, LogNamingConventionValidation, Display, TEXT( "Run with -UpdateBaseline to remove the fixed violations from the baseline" ) );
+    }
+
+    return new_violation_count == 0;
+}
+
+//static
+bool UNamingConventionValidationCommandlet::GenerateMatcher( const FString & module_directory, const FString & module_name )
+{
+    FString error;
+    if ( !FNamingConventionValidationCompiledMatcher::GenerateModule( error, module_directory, module_name, *GetDefault< UNamingConventionValidationSettings >() ) )
+    {
+        UE_LOG( LogNamingConventionValidation, Error, TEXT( "Failed to generate the compiled matcher : %s" ), *error );
+        return false;
+    }
+
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "Generated the module %s in %s" ), *module_name, *module_directory );
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "Add it to the modules of the project or of a plugin, with the type Editor and the loading phase Default. It is only used while the class descriptions do not change" ) );
+    return true;
+}
+
+//static
+bool UNamingConventionValidationCommandlet::BenchmarkMatcher( TArrayView< FString > paths, const int32 iteration_count )
+{
+    const auto * editor_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
+    check( editor_validator_subsystem );
+
+    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName );
+    asset_registry_module.Get().ScanPathsSynchronous( TArray< FString >( paths ), true );
+
+    TArray< FAssetData > asset_data_list;
+    editor_validator_subsystem->GetAssetsToValidate( asset_data_list, paths );
+
+    FNamingConventionMatcherBenchmark benchmark;
+    if ( !editor_validator_subsystem->BenchmarkCompiledMatcher( benchmark, asset_data_list, iteration_count ) )
+    {
+        UE_LOG( LogNamingConventionValidation, Error, TEXT( "No compiled matcher matches the class descriptions of the settings. Generate it with -GenerateMatcher" ) );
+        return false;
+    }
+
+    const auto match_count = FMath::Max( benchmark.AssetCount * benchmark.IterationCount, 1 );
+    const auto log_matcher = [ & ]( const TCHAR * matcher_name, const double seconds ) {
+        UE_LOG( LogNamingConventionValidation, Display, TEXT( "%-40s : %8.2f ms, %6.1f ns per name, %5.2fx the dynamic matching" ), matcher_name, seconds * 1000.0, seconds * 1.0e9 / match_count, seconds > 0.0 ? benchmark.DynamicSeconds / seconds : 0.0 );
+    };
 
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "Matched the names of %i assets %i times" ), benchmark.AssetCount, benchmark.IterationCount );
+    log_matcher( TEXT( "Dynamic" ), benchmark.DynamicSeconds );
+    log_matcher( TEXT( "Compiled, class hierarchy walked per name" ), benchmark.CompiledSeconds );
+    log_matcher( TEXT( "Compiled, compiled classes cached" ), benchmark.CachedCompiledSeconds );
     return true;
 }
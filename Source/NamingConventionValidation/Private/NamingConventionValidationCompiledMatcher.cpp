@@ -0,0 +1,375 @@
+#include "NamingConventionValidationCompiledMatcher.h"
+
+#include "NamingConventionValidationSettings.h"
+
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Misc/SecureHash.h>
+
+namespace
+{
+    // The generated modules register their tables on the game thread, when they start
+    TArray< const FNamingConventionCompiledMatcherTable * > RegisteredTables;
+
+    // Seeds tried before the slot count doubles
+    constexpr uint32 MaxSeedsPerSlotCount = 4096;
+
+    FString EscapeForSource( const FString & string )
+    {
+        return string.Replace( TEXT( "\\" ), TEXT( "\\\\" ) ).Replace( TEXT( "\"" ), TEXT( "\\\"" ) );
+    }
+
+    bool IsValidModuleName( const FString & module_name )
+    {
+        if ( module_name.IsEmpty() || FChar::IsDigit( module_name[ 0 ] ) )
+        {
+            return false;
+        }
+
+        for ( const auto character : module_name )
+        {
+            if ( !FChar::IsAlnum( character ) && character != TEXT( '_' ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+void FNamingConventionValidationCompiledMatcher::RegisterTable( const FNamingConventionCompiledMatcherTable & table )
+{
+    check( IsInGameThread() );
+
+    RegisteredTables.AddUnique( &table );
+    OnRegisteredTablesChanged().Broadcast();
+}
+
+void FNamingConventionValidationCompiledMatcher::UnregisterTable( const FNamingConventionCompiledMatcherTable & table )
+{
+    check( IsInGameThread() );
+
+    RegisteredTables.Remove( &table );
+    OnRegisteredTablesChanged().Broadcast();
+}
+
+FSimpleMulticastDelegate & FNamingConventionValidationCompiledMatcher::OnRegisteredTablesChanged()
+{
+    static FSimpleMulticastDelegate RegisteredTablesChangedDelegate;
+    return RegisteredTablesChangedDelegate;
+}
+
+FString FNamingConventionValidationCompiledMatcher::GetClassDescriptionsFingerprint( const UNamingConventionValidationSettings & settings )
+{
+    FSHA1 sha1;
+    const auto update_hash = [ & ]( const FString & string ) {
+        sha1.UpdateWithString( *string, string.Len() );
+        sha1.UpdateWithString( TEXT( "\n" ), 1 );
+    };
+
+    for ( const auto & class_description : settings.ClassDescriptions )
+    {
+        update_hash( class_description.Class != nullptr ? class_description.Class->GetClassPathName().ToString() : class_description.ClassPath.ToString() );
+        update_hash( class_description.Prefix );
+        update_hash( class_description.Suffix );
+    }
+
+    sha1.Final();
+
+    FSHAHash hash;
+    sha1.GetHash( hash.Hash );
+    return hash.ToString();
+}
+
+const FNamingConventionCompiledMatcherTable * FNamingConventionValidationCompiledMatcher::FindTable( const UNamingConventionValidationSettings & settings )
+{
+    if ( RegisteredTables.IsEmpty() )
+    {
+        return nullptr;
+    }
+
+    // The dynamic matching reports the class descriptions without a valid class
+    if ( settings.ClassDescriptions.ContainsByPredicate( []( const FNamingConventionValidationClassDescription & class_description ) {
+             return class_description.Class == nullptr;
+         } ) )
+    {
+        return nullptr;
+    }
+
+    const auto fingerprint = GetClassDescriptionsFingerprint( settings );
+
+    for ( const auto * table : RegisteredTables )
+    {
+        if ( fingerprint.Equals( table->ClassDescriptionsFingerprint ) && table->ClassDescriptionCount == settings.ClassDescriptions.Num() )
+        {
+            return table;
+        }
+    }
+
+    return nullptr;
+}
+
+uint32 FNamingConventionValidationCompiledMatcher::HashClassPath( const FStringView class_path, const uint32 seed )
+{
+    // FNV-1a on the characters, so the hash does not depend on the size of TCHAR, then a final mix for the low bits the slot is taken from
+    auto hash = 2166136261u ^ seed;
+    for ( const auto character : class_path )
+    {
+        hash = ( hash ^ static_cast< uint32 >( character ) ) * 16777619u;
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    return hash;
+}
+
+void FNamingConventionValidationCompiledMatcher::GatherClassDescriptions( TArray< int32, FNamingConventionScratchAllocator > & class_description_indices, const FNamingConventionCompiledMatcherTable & table, const FNamingConventionCompiledClass * compiled_class )
+{
+    class_description_indices.Reset();
+
+    if ( compiled_class == nullptr )
+    {
+        return;
+    }
+
+    for ( auto index = 0; index < compiled_class->ClassDescriptionCount; ++index )
+    {
+        class_description_indices.Add( table.ClassDescriptions[ compiled_class->FirstClassDescription + index ].ClassDescriptionIndex );
+    }
+}
+
+ENamingConventionValidationResult FNamingConventionValidationCompiledMatcher::MatchName( int32 & failed_class_description_index, bool & it_has_wrong_suffix, const FNamingConventionCompiledMatcherTable & table, const FNamingConventionCompiledClass * compiled_class, const FStringView asset_name )
+{
+    failed_class_description_index = INDEX_NONE;
+    it_has_wrong_suffix = false;
+
+    if ( compiled_class == nullptr )
+    {
+        return ENamingConventionValidationResult::Unknown;
+    }
+
+    // Like DoesAssetMatchesClassDescriptions, the class descriptions of the class are alternatives, and the last one which fails is reported
+    for ( auto index = 0; index < compiled_class->ClassDescriptionCount; ++index )
+    {
+        const auto & class_description = table.ClassDescriptions[ compiled_class->FirstClassDescription + index ];
+        const auto it_matches_prefix = asset_name.StartsWith( FStringView( class_description.Prefix, class_description.PrefixLength ), ESearchCase::IgnoreCase );
+        const auto it_matches_suffix = asset_name.EndsWith( FStringView( class_description.Suffix, class_description.SuffixLength ), ESearchCase::IgnoreCase );
+
+        if ( it_matches_prefix && it_matches_suffix )
+        {
+            failed_class_description_index = INDEX_NONE;
+            it_has_wrong_suffix = false;
+            return ENamingConventionValidationResult::Valid;
+        }
+
+        failed_class_description_index = class_description.ClassDescriptionIndex;
+        it_has_wrong_suffix = !it_matches_suffix;
+    }
+
+    return ENamingConventionValidationResult::Invalid;
+}
+
+const FNamingConventionCompiledClass * FNamingConventionValidationCompiledMatcher::FindClass( const FNamingConventionCompiledMatcherTable & table, const UClass * asset_class )
+{
+    // The first class of the hierarchy found in the table is the most precise one
+    for ( const auto * super_class = asset_class; super_class != nullptr; super_class = super_class->GetSuperClass() )
+    {
+        TStringBuilder< 256 > class_path;
+        super_class->GetClassPathName().AppendString( class_path );
+
+        const auto slot = HashClassPath( class_path.ToView(), table.HashSeed ) & ( table.ClassSlotCount - 1 );
+        const auto class_index = table.ClassSlots[ slot ];
+
+        if ( class_index == INDEX_NONE )
+        {
+            continue;
+        }
+
+        const auto & compiled_class = table.Classes[ class_index ];
+        if ( FStringView( compiled_class.ClassPath, compiled_class.ClassPathLength ).Equals( class_path.ToView(), ESearchCase::CaseSensitive ) )
+        {
+            return &compiled_class;
+        }
+    }
+
+    return nullptr;
+}
+
+bool FNamingConventionValidationCompiledMatcher::GenerateModule( FString & error, const FString & module_directory, const FString & module_name, const UNamingConventionValidationSettings & settings )
+{
+    if ( !IsValidModuleName( module_name ) )
+    {
+        error = FString::Printf( TEXT( "%s is not a valid module name" ), *module_name );
+        return false;
+    }
+
+    const auto & class_descriptions = settings.ClassDescriptions;
+    if ( class_descriptions.IsEmpty() )
+    {
+        error = TEXT( "There are no class descriptions to compile" );
+        return false;
+    }
+
+    for ( const auto & class_description : class_descriptions )
+    {
+        if ( class_description.Class == nullptr )
+        {
+            error = FString::Printf( TEXT( "The class of the class description %s is not valid" ), *class_description.ToString() );
+            return false;
+        }
+    }
+
+    // The classes are in the order of their first class description, and their class descriptions in the order of the settings
+    TArray< FString > class_paths;
+    TArray< TArray< int32 > > class_description_indices_per_class;
+
+    for ( auto class_description_index = 0; class_description_index < class_descriptions.Num(); ++class_description_index )
+    {
+        const auto class_path = class_descriptions[ class_description_index ].Class->GetClassPathName().ToString();
+
+        auto class_index = class_paths.IndexOfByKey( class_path );
+        if ( class_index == INDEX_NONE )
+        {
+            class_index = class_paths.Add( class_path );
+            class_description_indices_per_class.AddDefaulted();
+        }
+
+        class_description_indices_per_class[ class_index ].Add( class_description_index );
+    }
+
+    // Looks for a seed which gives each class its own slot, with twice as many slots as classes to begin with
+    auto slot_count = static_cast< int32 >( FMath::RoundUpToPowerOfTwo( FMath::Max( class_paths.Num() * 2, 2 ) ) );
+    auto seed = 0u;
+    TArray< int32 > class_slots;
+
+    const auto try_fill_slots = [ & ]() {
+        class_slots.Init( INDEX_NONE, slot_count );
+
+        for ( auto class_index = 0; class_index < class_paths.Num(); ++class_index )
+        {
+            auto & class_slot = class_slots[ HashClassPath( class_paths[ class_index ], seed ) & ( slot_count - 1 ) ];
+            if ( class_slot != INDEX_NONE )
+            {
+                return false;
+            }
+
+            class_slot = class_index;
+        }
+
+        return true;
+    };
+
+    while ( !try_fill_slots() )
+    {
+        if ( ++seed == MaxSeedsPerSlotCount )
+        {
+            seed = 0;
+            slot_count *= 2;
+        }
+    }
+
+    FString source;
+    source += TEXT( "// Generated by the NamingConventionValidation commandlet with -GenerateMatcher, from the class descriptions of the settings.\n" );
+    source += TEXT( "// Generate it again when the class descriptions change. Until then, the validation ignores these tables and matches the class descriptions dynamically\n\n" );
+    source += TEXT( "#include \"NamingConventionValidationCompiledMatcher.h\"\n\n" );
+    source += TEXT( "#include <Modules/ModuleManager.h>\n\n" );
+    source += TEXT( "namespace\n{\n" );
+
+    source += TEXT( "    constexpr FNamingConventionCompiledClass Classes[] = {\n" );
+    auto first_class_description = 0;
+    for ( auto class_index = 0; class_index < class_paths.Num(); ++class_index )
+    {
+        const auto class_description_count = class_description_indices_per_class[ class_index ].Num();
+        source += FString::Printf( TEXT( "        { TEXT( \"%s\" ), %i, %i, %i },\n" ), *EscapeForSource( class_paths[ class_index ] ), class_paths[ class_index ].Len(), first_class_description, class_description_count );
+        first_class_description += class_description_count;
+    }
+    source += TEXT( "    };\n\n" );
+
+    source += TEXT( "    constexpr FNamingConventionCompiledClassDescription ClassDescriptions[] = {\n" );
+    for ( const auto & class_description_indices : class_description_indices_per_class )
+    {
+        for ( const auto class_description_index : class_description_indices )
+        {
+            const auto & class_description = class_descriptions[ class_description_index ];
+            source += FString::Printf( TEXT( "        { %i, TEXT( \"%s\" ), %i, TEXT( \"%s\" ), %i },\n" ),
+                class_description_index,
+                *EscapeForSource( class_description.Prefix ),
+                class_description.Prefix.Len(),
+                *EscapeForSource( class_description.Suffix ),
+                class_description.Suffix.Len() );
+        }
+    }
+    source += TEXT( "    };\n\n" );
+
+    source += TEXT( "    constexpr int32 ClassSlots[] = {\n" );
+    for ( const auto class_slot : class_slots )
+    {
+        source += FString::Printf( TEXT( "        %i,\n" ), class_slot );
+    }
+    source += TEXT( "    };\n\n" );
+
+    source += TEXT( "    constexpr FNamingConventionCompiledMatcherTable Table {\n" );
+    source += FString::Printf( TEXT( "        TEXT( \"%s\" ),\n" ), *GetClassDescriptionsFingerprint( settings ) );
+    source += TEXT( "        Classes,\n" );
+    source += TEXT( "        UE_ARRAY_COUNT( Classes ),\n" );
+    source += TEXT( "        ClassDescriptions,\n" );
+    source += TEXT( "        UE_ARRAY_COUNT( ClassDescriptions ),\n" );
+    source += TEXT( "        ClassSlots,\n" );
+    source += TEXT( "        UE_ARRAY_COUNT( ClassSlots ),\n" );
+    source += FString::Printf( TEXT( "        %uu\n" ), seed );
+    source += TEXT( "    };\n" );
+    source += TEXT( "}\n\n" );
+
+    source += FString::Printf( TEXT( "class F%sModule final : public IModuleInterface\n{\npublic:\n" ), *module_name );
+    source += TEXT( "    void StartupModule() override\n    {\n        FNamingConventionValidationCompiledMatcher::RegisterTable( Table );\n    }\n\n" );
+    source += TEXT( "    void ShutdownModule() override\n    {\n        FNamingConventionValidationCompiledMatcher::UnregisterTable( Table );\n    }\n};\n\n" );
+    source += FString::Printf( TEXT( "IMPLEMENT_MODULE( F%sModule, %s )\n" ), *module_name, *module_name );
+
+    FString build_rules;
+    build_rules += TEXT( "namespace UnrealBuildTool.Rules\n{\n" );
+    build_rules += TEXT( "    // Generated by the NamingConventionValidation commandlet with -GenerateMatcher\n" );
+    build_rules += FString::Printf( TEXT( "    public class %s : ModuleRules\n    {\n" ), *module_name );
+    build_rules += FString::Printf( TEXT( "        public %s( ReadOnlyTargetRules Target )\n            : base( Target )\n        {\n" ), *module_name );
+    build_rules += TEXT( "            PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;\n\n" );
+    build_rules += TEXT( "            PrivateDependencyModuleNames.AddRange(\n                new string[] {\n" );
+    build_rules += TEXT( "                    \"Core\",\n                    \"CoreUObject\",\n                    \"NamingConventionValidation\"\n" );
+    build_rules += TEXT( "                }\n            );\n        }\n    }\n}\n" );
+
+    const auto source_file_path = FPaths::Combine( module_directory, TEXT( "Private" ), module_name + TEXT( "Module.cpp" ) );
+    const auto build_rules_file_path = FPaths::Combine( module_directory, module_name + TEXT( ".Build.cs" ) );
+
+    if ( !FFileHelper::SaveStringToFile( source, *source_file_path ) || !FFileHelper::SaveStringToFile( build_rules, *build_rules_file_path ) )
+    {
+        error = FString::Printf( TEXT( "Impossible to write the module in %s" ), *module_directory );
+        return false;
+    }
+
+    return true;
+}
+
+void FNamingConventionCompiledClassCache::Reset( const FNamingConventionCompiledMatcherTable * table )
+{
+    check( IsInGameThread() );
+
+    Table = table;
+    CompiledClasses.Reset();
+}
+
+const FNamingConventionCompiledClass * FNamingConventionCompiledClassCache::FindClass( const UClass * asset_class )
+{
+    check( IsInGameThread() );
+
+    if ( Table == nullptr || asset_class == nullptr )
+    {
+        return nullptr;
+    }
+
+    if ( const auto * compiled_class = CompiledClasses.Find( asset_class ) )
+    {
+        return *compiled_class;
+    }
+
+    return CompiledClasses.Add( asset_class, FNamingConventionValidationCompiledMatcher::FindClass( *Table, asset_class ) );
+}
@@ -0,0 +1,173 @@
+#include "NamingConventionValidationCook.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationLog.h"
+#include "NamingConventionValidationMemory.h"
+#include "NamingConventionValidationSettings.h"
+
+#include <AssetRegistry/AssetRegistryModule.h>
+#include <CookOnTheSide/CookOnTheFlyServer.h>
+#include <Dom/JsonObject.h>
+#include <Editor.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Serialization/JsonSerializer.h>
+#include <UObject/ObjectSaveContext.h>
+#include <UObject/Package.h>
+
+FNamingConventionValidationCook::FNamingConventionValidationCook() :
+    ValidatedAssetCount( 0 ),
+    NewViolationCount( 0 ),
+    ItHasWrittenReport( false )
+{
+    FString baseline_file_path;
+    if ( FParse::Value( FCommandLine::Get(), TEXT( "NamingConventionBaseline=" ), baseline_file_path ) )
+    {
+        UE_CLOG( !Baseline.Load( baseline_file_path ), LogNamingConventionValidation, Display, TEXT( "No naming convention baseline found at %s, all the violations are new" ), *baseline_file_path );
+    }
+
+    if ( !FParse::Value( FCommandLine::Get(), TEXT( "NamingConventionCookReport=" ), ReportFilePath ) )
+    {
+        ReportFilePath = FPaths::ProjectSavedDir() / TEXT( "NamingConventionValidation" ) / TEXT( "CookReport.json" );
+    }
+
+    OnPackageSavedDelegateHandle = UPackage::PackageSavedWithContextEvent.AddRaw( this, &FNamingConventionValidationCook::OnPackageSaved );
+    OnCookFinishedDelegateHandle = UE::Cook::FDelegates::CookByTheBookFinished.AddRaw( this, &FNamingConventionValidationCook::OnCookFinished );
+}
+
+FNamingConventionValidationCook::~FNamingConventionValidationCook()
+{
+    UPackage::PackageSavedWithContextEvent.Remove( OnPackageSavedDelegateHandle );
+    UE::Cook::FDelegates::CookByTheBookFinished.Remove( OnCookFinishedDelegateHandle );
+
+    // The cook on the fly servers never finish
+    if ( !ItHasWrittenReport && !ValidatedPackages.IsEmpty() )
+    {
+        WriteReport();
+    }
+}
+
+bool FNamingConventionValidationCook::IsEnabled()
+{
+    return IsRunningCookCommandlet() && ( GetDefault< UNamingConventionValidationSettings >()->bValidateWhileCooking || FParse::Param( FCommandLine::Get(), TEXT( "ValidateNamingConvention" ) ) );
+}
+
+void FNamingConventionValidationCook::OnPackageSaved( const FString & /*package_file_name*/, UPackage * package, const FObjectPostSaveContext context )
+{
+    if ( !context.IsCooking() || package == nullptr )
+    {
+        return;
+    }
+
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
+    bool it_is_already_validated = false;
+    ValidatedPackages.Add( package->GetFName(), &it_is_already_validated );
+    if ( it_is_already_validated )
+    {
+        return;
+    }
+
+    const auto * subsystem = GEditor != nullptr ? GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() : nullptr;
+    if ( subsystem == nullptr )
+    {
+        return;
+    }
+
+    // The cook keeps its registry up to date with the packages it loads, and the package being saved has its classes loaded
+    const auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get();
+
+    TArray< FAssetData > asset_data_list;
+    asset_registry.GetAssetsByPackageName( package->GetFName(), asset_data_list, true );
+
+    const auto it_fails_cook = GetDefault< UNamingConventionValidationSettings >()->bFailCookOnNewViolations;
+
+    for ( const auto & asset_data : asset_data_list )
+    {
+        FText error_message;
+        FName rule_id;
+        const auto result = subsystem->IsAssetNamedCorrectly( error_message, rule_id, asset_data );
+
+        ++ValidatedAssetCount;
+
+        if ( result != ENamingConventionValidationResult::Invalid )
+        {
+            continue;
+        }
+
+        const auto it_is_known = Baseline.IsLoaded() && Baseline.RecordViolation( asset_data.PackageName, rule_id );
+        Violations.Add( { asset_data.PackageName, asset_data.AssetName, rule_id, error_message, it_is_known } );
+
+        if ( it_is_known )
+        {
+            continue;
+        }
+
+        ++NewViolationCount;
+
+        if ( it_fails_cook )
+        {
+            UE_LOG( LogNamingConventionValidation, Error, TEXT( "%s does not match naming convention. %s" ), *asset_data.PackageName.ToString(), *error_message.ToString() );
+        }
+        else
+        {
+            UE_LOG( LogNamingConventionValidation, Warning, TEXT( "%s does not match naming convention. %s" ), *asset_data.PackageName.ToString(), *error_message.ToString() );
+        }
+    }
+}
+
+void FNamingConventionValidationCook::OnCookFinished( UE::Cook::ICookInfo & /*cook_info*/ )
+{
+    WriteReport();
+}
+
+void FNamingConventionValidationCook::WriteReport()
+{
+    ItHasWrittenReport = true;
+
+    // Sorted, so the reports of two cooks can be compared
+    Violations.Sort( []( const FViolation & left, const FViolation & right ) {
+        return left.PackageName.LexicalLess( right.PackageName ) || ( left.PackageName == right.PackageName && left.AssetName.LexicalLess( right.AssetName ) );
+    } );
+
+    TArray< TSharedPtr< FJsonValue > > violation_values;
+    violation_values.Reserve( Violations.Num() );
+
+    for ( const auto & violation : Violations )
+    {
+        auto violation_object = MakeShared< FJsonObject >();
+        violation_object->SetStringField( TEXT( "packageName" ), violation.PackageName.ToString() );
+        violation_object->SetStringField( TEXT( "assetName" ), violation.AssetName.ToString() );
+        violation_object->SetStringField( TEXT( "ruleId" ), violation.RuleId.ToString() );
+        violation_object->SetStringField( TEXT( "message" ), violation.Message.ToString() );
+        violation_object->SetBoolField( TEXT( "known" ), violation.ItIsKnown );
+        violation_values.Add( MakeShared< FJsonValueObject >( violation_object ) );
+    }
+
+    const auto report = MakeShared< FJsonObject >();
+    report->SetNumberField( TEXT( "validatedPackageCount" ), ValidatedPackages.Num() );
+    report->SetNumberField( TEXT( "validatedAssetCount" ), ValidatedAssetCount );
+    report->SetNumberField( TEXT( "newViolationCount" ), NewViolationCount );
+    report->SetNumberField( TEXT( "knownViolationCount" ), Violations.Num() - NewViolationCount );
+    report->SetArrayField( TEXT( "violations" ), violation_values );
+
+    FString report_string;
+    FJsonSerializer::Serialize( report, TJsonWriterFactory<>::Create( &report_string ) );
+
+    if ( FFileHelper::SaveStringToFile( report_string, *ReportFilePath ) )
+    {
+        UE_LOG( LogNamingConventionValidation, Display, TEXT( "Wrote the naming convention cook report to %s" ), *ReportFilePath );
+    }
+    else
+    {
+        UE_LOG( LogNamingConventionValidation, Warning, TEXT( "Could not write the naming convention cook report to %s" ), *ReportFilePath );
+    }
+
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "Naming convention validation of the cook : %i packages, %i assets, %i new violations, %i known violations" ), ValidatedPackages.Num(), ValidatedAssetCount, NewViolationCount, Violations.Num() - NewViolationCount );
+
+    UE_CLOG( NewViolationCount > 0 && GetDefault< UNamingConventionValidationSettings >()->bFailCookOnNewViolations,
+        LogNamingConventionValidation,
+        Error,
+        TEXT( "The cook found %i new naming convention violations" ),
+        NewViolationCount );
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "NamingConventionValidationBaseline.h"
+
+#include <CoreMinimal.h>
+
+class FObjectPostSaveContext;
+class UPackage;
+
+namespace UE::Cook
+{
+    class ICookInfo;
+}
+
+// Validates the assets of each package when the cook saves it, then writes a report when the cook finishes.
+// The asset registry of the cook and the classes it has already loaded are used, nothing is scanned or loaded for the validation
+class FNamingConventionValidationCook
+{
+public:
+    UE_NONCOPYABLE( FNamingConventionValidationCook );
+
+    FNamingConventionValidationCook();
+    ~FNamingConventionValidationCook();
+
+    // True when the settings or the command line of the cook enable the validation
+    static bool IsEnabled();
+
+private:
+    struct FViolation
+    {
+        FName PackageName;
+        FName AssetName;
+        FName RuleId;
+        FText Message;
+        bool ItIsKnown;
+    };
+
+    void OnPackageSaved( const FString & package_file_name, UPackage * package, FObjectPostSaveContext context );
+    void OnCookFinished( UE::Cook::ICookInfo & cook_info );
+    void WriteReport();
+
+    FNamingConventionValidationBaseline Baseline;
+    FString ReportFilePath;
+    // A package is saved once per target platform, but validated once
+    TSet< FName > ValidatedPackages;
+    TArray< FViolation > Violations;
+    int32 ValidatedAssetCount;
+    int32 NewViolationCount;
+    bool ItHasWrittenReport;
+    FDelegateHandle OnPackageSavedDelegateHandle;
+    FDelegateHandle OnCookFinishedDelegateHandle;
+};
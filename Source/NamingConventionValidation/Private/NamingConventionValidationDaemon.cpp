@@ -0,0 +1,521 @@
+#include "NamingConventionValidationDaemon.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationLog.h"
+#include "NamingConventionValidationMemory.h"
+#include "NamingConventionValidationRun.h"
+
+#include <AssetRegistry/AssetRegistryModule.h>
+#include <Async/TaskGraphInterfaces.h>
+#include <Common/TcpSocketBuilder.h>
+#include <Containers/Ticker.h>
+#include <DirectoryWatcherModule.h>
+#include <Dom/JsonObject.h>
+#include <Editor.h>
+#include <Interfaces/IPv4/IPv4Endpoint.h>
+#include <JsonObjectConverter.h>
+#include <Misc/PackageName.h>
+#include <Policies/CondensedJsonPrintPolicy.h>
+#include <Serialization/JsonReader.h>
+#include <Serialization/JsonSerializer.h>
+#include <SocketSubsystem.h>
+#include <Sockets.h>
+
+namespace
+{
+    // A request is a single line, a client sending more without a line break is disconnected
+    constexpr int32 MaxRequestSize = 1024 * 1024;
+
+    // A client which does not read its responses is disconnected once they reach this size
+    constexpr int32 MaxPendingSendSize = 64 * 1024 * 1024;
+
+    IAssetRegistry & GetAssetRegistry()
+    {
+        return FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get();
+    }
+
+    IDirectoryWatcher * GetDirectoryWatcher()
+    {
+        return FModuleManager::LoadModuleChecked< FDirectoryWatcherModule >( TEXT( "DirectoryWatcher" ) ).Get();
+    }
+
+    bool IsPackageFile( const FString & filename )
+    {
+        const auto extension = FPaths::GetExtension( filename, true );
+        return extension == FPackageName::GetAssetPackageExtension() || extension == FPackageName::GetMapPackageExtension();
+    }
+
+    void SetError( FJsonObject & response, const FString & error )
+    {
+        response.SetStringField( TEXT( "status" ), TEXT( "error" ) );
+        response.SetStringField( TEXT( "error" ), error );
+    }
+}
+
+FNamingConventionValidationDaemon::FNamingConventionValidationDaemon( const int32 port ) :
+    Port( port ),
+    ListenSocket( nullptr ),
+    ItIsShutdownRequested( false ),
+    ItNeedsGarbageCollection( false )
+{
+}
+
+FNamingConventionValidationDaemon::~FNamingConventionValidationDaemon()
+{
+    for ( auto & connection : Connections )
+    {
+        CloseConnection( connection );
+    }
+    Connections.Reset();
+
+    if ( ListenSocket != nullptr )
+    {
+        ListenSocket->Close();
+        ISocketSubsystem::Get( PLATFORM_SOCKETSUBSYSTEM )->DestroySocket( ListenSocket );
+        ListenSocket = nullptr;
+    }
+
+    UnwatchContentDirectories();
+}
+
+bool FNamingConventionValidationDaemon::Start()
+{
+    // Scanned once, then kept up to date from the changes of the files
+    GetAssetRegistry().SearchAllAssets( true );
+
+    ListenSocket = FTcpSocketBuilder( TEXT( "NamingConventionValidationDaemon" ) )
+                       .AsNonBlocking()
+                       .AsReusable()
+                       .BoundToEndpoint( FIPv4Endpoint( FIPv4Address::InternalLoopback, static_cast< uint16 >( Port ) ) )
+                       .Listening( 8 )
+                       .Build();
+
+    if ( ListenSocket == nullptr )
+    {
+        UE_LOG( LogNamingConventionValidation, Error, TEXT( "The naming convention validation daemon could not listen to the port %i" ), Port );
+        return false;
+    }
+
+    WatchContentDirectories();
+
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "The naming convention validation daemon is listening to 127.0.0.1:%i" ), Port );
+    return true;
+}
+
+void FNamingConventionValidationDaemon::Run()
+{
+    auto & asset_registry = GetAssetRegistry();
+    auto * directory_watcher = GetDirectoryWatcher();
+    auto last_time = FPlatformTime::Seconds();
+
+    // The commandlet has no engine loop, so the systems the validation relies on are ticked here
+    while ( !ItIsShutdownRequested && !IsEngineExitRequested() )
+    {
+        const auto time = FPlatformTime::Seconds();
+        const auto delta_time = static_cast< float >( time - last_time );
+        last_time = time;
+
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle( ENamedThreads::GameThread );
+        FTSTicker::GetCoreTicker().Tick( delta_time );
+
+        if ( directory_watcher != nullptr )
+        {
+            directory_watcher->Tick( delta_time );
+        }
+
+        asset_registry.Tick( delta_time );
+
+        ScanChangedFiles();
+        AcceptConnections();
+
+        for ( auto index = Connections.Num() - 1; index >= 0; --index )
+        {
+            if ( !ProcessConnection( Connections[ index ] ) )
+            {
+                CloseConnection( Connections[ index ] );
+                Connections.RemoveAtSwap( index );
+            }
+        }
+
+        // Between the requests, so a long-lived daemon does not keep all the packages the validations loaded
+        if ( ItNeedsGarbageCollection )
+        {
+            CollectGarbage( GARBAGE_COLLECTION_KEEPFLAGS );
+            ItNeedsGarbageCollection = false;
+        }
+
+        // Short enough to not delay the requests noticeably
+        FPlatformProcess::Sleep( 0.005f );
+    }
+
+    // At least the beginning of the response to the shutdown command, the connections are closed right after
+    for ( auto & connection : Connections )
+    {
+        SendPendingData( connection );
+    }
+
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "The naming convention validation daemon has stopped" ) );
+}
+
+void FNamingConventionValidationDaemon::WatchContentDirectories()
+{
+    auto * directory_watcher = GetDirectoryWatcher();
+    if ( directory_watcher == nullptr )
+    {
+        UE_LOG( LogNamingConventionValidation, Warning, TEXT( "No directory watcher on this platform, the changes of the content will only be seen for the requested files" ) );
+        return;
+    }
+
+    // The content of the project and of its plugins, the engine content does not change
+    const auto project_directory = FPaths::ConvertRelativePathToFull( FPaths::ProjectDir() );
+
+    TArray< FString > root_paths;
+    FPackageName::QueryRootContentPaths( root_paths );
+
+    for ( const auto & root_path : root_paths )
+    {
+        FString directory;
+        if ( !FPackageName::TryConvertLongPackageNameToFilename( root_path, directory ) )
+        {
+            continue;
+        }
+
+        directory = FPaths::ConvertRelativePathToFull( directory );
+        if ( !FPaths::IsUnderDirectory( directory, project_directory ) || WatchedDirectories.Contains( directory ) )
+        {
+            continue;
+        }
+
+        FDelegateHandle handle;
+        if ( directory_watcher->RegisterDirectoryChangedCallback_Handle( directory, IDirectoryWatcher::FDirectoryChanged::CreateRaw( this, &FNamingConventionValidationDaemon::OnDirectoryChanged ), handle ) )
+        {
+            WatchedDirectories.Add( directory, handle );
+        }
+    }
+}
+
+void FNamingConventionValidationDaemon::UnwatchContentDirectories()
+{
+    if ( WatchedDirectories.IsEmpty() )
+    {
+        return;
+    }
+
+    if ( auto * directory_watcher = GetDirectoryWatcher() )
+    {
+        for ( const auto & [ directory, handle ] : WatchedDirectories )
+        {
+            directory_watcher->UnregisterDirectoryChangedCallback_Handle( directory, handle );
+        }
+    }
+
+    WatchedDirectories.Reset();
+}
+
+void FNamingConventionValidationDaemon::OnDirectoryChanged( const TArray< FFileChangeData > & file_changes )
+{
+    // The removed packages are also kept, to remove their assets from the asset registry
+    for ( const auto & file_change : file_changes )
+    {
+        if ( IsPackageFile( file_change.Filename ) )
+        {
+            ChangedFiles.Add( file_change.Filename );
+        }
+    }
+}
+
+void FNamingConventionValidationDaemon::ScanChangedFiles()
+{
+    if ( ChangedFiles.IsEmpty() )
+    {
+        return;
+    }
+
+    TArray< FString > files;
+    TArray< FString > removed_files;
+    files.Reserve( ChangedFiles.Num() );
+
+    for ( const auto & file : ChangedFiles )
+    {
+        if ( FPaths::FileExists( file ) )
+        {
+            files.Add( file );
+        }
+        else
+        {
+            removed_files.Add( file );
+        }
+    }
+
+    ChangedFiles.Reset();
+
+    if ( !files.IsEmpty() )
+    {
+        UE_LOG( LogNamingConventionValidation, Verbose, TEXT( "Scanning %i changed packages" ), files.Num() );
+        GetAssetRegistry().ScanFilesSynchronous( files, true );
+    }
+
+    // The folder requests would still validate the assets of the removed packages
+    if ( !removed_files.IsEmpty() )
+    {
+        UE_LOG( LogNamingConventionValidation, Verbose, TEXT( "Removing %i deleted packages" ), removed_files.Num() );
+        GetAssetRegistry().ScanModifiedAssetFiles( removed_files );
+    }
+}
+
+void FNamingConventionValidationDaemon::AcceptConnections()
+{
+    bool it_has_pending_connection = false;
+    while ( ListenSocket->HasPendingConnection( it_has_pending_connection ) && it_has_pending_connection )
+    {
+        auto * socket = ListenSocket->Accept( TEXT( "NamingConventionValidationDaemonClient" ) );
+        if ( socket == nullptr )
+        {
+            break;
+        }
+
+        // A client which does not read its responses must not block the daemon, so they are buffered instead
+        socket->SetNonBlocking( true );
+        Connections.Add( { socket } );
+    }
+}
+
+bool FNamingConventionValidationDaemon::ProcessConnection( FConnection & connection )
+{
+    uint8 buffer[ 4096 ];
+    uint32 pending_size = 0;
+
+    while ( connection.Socket->HasPendingData( pending_size ) && pending_size > 0 )
+    {
+        auto read_size = 0;
+        if ( !connection.Socket->Recv( buffer, FMath::Min< int32 >( pending_size, sizeof( buffer ) ), read_size ) )
+        {
+            return false;
+        }
+
+        connection.ReceivedData.Append( buffer, read_size );
+    }
+
+    auto line_end = INDEX_NONE;
+    while ( connection.ReceivedData.Find( static_cast< uint8 >( '\n' ), line_end ) )
+    {
+        const FUTF8ToTCHAR request( reinterpret_cast< const ANSICHAR * >( connection.ReceivedData.GetData() ), line_end );
+        const FString request_string( request.Length(), request.Get() );
+        connection.ReceivedData.RemoveAt( 0, line_end + 1 );
+
+        if ( request_string.TrimStartAndEnd().IsEmpty() )
+        {
+            continue;
+        }
+
+        QueueResponse( connection, ProcessRequest( request_string ) );
+    }
+
+    if ( !SendPendingData( connection ) )
+    {
+        return false;
+    }
+
+    if ( connection.ReceivedData.Num() > MaxRequestSize )
+    {
+        UE_LOG( LogNamingConventionValidation, Warning, TEXT( "Closing a naming convention validation daemon connection which sent a request bigger than %i bytes" ), MaxRequestSize );
+        return false;
+    }
+
+    return connection.Socket->GetConnectionState() == SCS_Connected;
+}
+
+TSharedRef< FJsonObject > FNamingConventionValidationDaemon::ProcessRequest( const FString & request_string )
+{
+    auto response = MakeShared< FJsonObject >();
+
+    TSharedPtr< FJsonObject > request;
+    if ( !FJsonSerializer::Deserialize( TJsonReaderFactory<>::Create( request_string ), request ) || !request.IsValid() )
+    {
+        SetError( *response, TEXT( "The request is not a JSON object" ) );
+        return response;
+    }
+
+    // Lets the clients match the responses to their requests
+    if ( const auto id = request->TryGetField( TEXT( "id" ) ) )
+    {
+        response->SetField( TEXT( "id" ), id );
+    }
+
+    FString command;
+    request->TryGetStringField( TEXT( "command" ), command );
+
+    if ( command == TEXT( "validate" ) )
+    {
+        Validate( *response, *request );
+        ItNeedsGarbageCollection = true;
+    }
+    else if ( command == TEXT( "ping" ) )
+    {
+        response->SetStringField( TEXT( "status" ), TEXT( "ok" ) );
+    }
+    else if ( command == TEXT( "shutdown" ) )
+    {
+        ItIsShutdownRequested = true;
+        response->SetStringField( TEXT( "status" ), TEXT( "ok" ) );
+    }
+    else
+    {
+        SetError( *response, FString::Printf( TEXT( "Unknown command '%s'" ), *command ) );
+    }
+
+    return response;
+}
+
+void FNamingConventionValidationDaemon::Validate( FJsonObject & response, const FJsonObject & request ) const
+{
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
+    const TArray< TSharedPtr< FJsonValue > > * path_values = nullptr;
+    if ( !request.TryGetArrayField( TEXT( "paths" ), path_values ) )
+    {
+        SetError( response, TEXT( "The validate command needs an array of paths" ) );
+        return;
+    }
+
+    const auto start_time = FPlatformTime::Seconds();
+    auto & asset_registry = GetAssetRegistry();
+    const auto * subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
+    check( subsystem != nullptr );
+
+    TArray< FAssetData > asset_data_list;
+    TArray< FString > folders;
+    TArray< TSharedPtr< FJsonValue > > not_found_values;
+
+    for ( const auto & path_value : *path_values )
+    {
+        const auto path = path_value->AsString();
+        auto package_name = path;
+
+        // Files and folders of the disk are accepted too, which is what the source control hooks and the IDEs have
+        if ( FPaths::FileExists( path ) || FPaths::DirectoryExists( path ) )
+        {
+            if ( !FPackageName::TryConvertFilenameToLongPackageName( path, package_name ) )
+            {
+                not_found_values.Add( MakeShared< FJsonValueString >( path ) );
+                continue;
+            }
+        }
+
+        package_name.RemoveFromEnd( TEXT( "/" ) );
+
+        FString filename;
+        if ( !FPackageName::IsValidLongPackageName( package_name ) )
+        {
+            not_found_values.Add( MakeShared< FJsonValueString >( path ) );
+        }
+        else if ( FPackageName::DoesPackageExist( package_name, &filename ) )
+        {
+            // The package may have been saved after the latest change seen by the directory watcher
+            asset_registry.ScanFilesSynchronous( { filename }, true );
+            asset_registry.GetAssetsByPackageName( FName( *package_name ), asset_data_list, true );
+        }
+        else if ( asset_registry.PathExists( package_name ) )
+        {
+            folders.Add( package_name );
+        }
+        else
+        {
+            not_found_values.Add( MakeShared< FJsonValueString >( path ) );
+        }
+    }
+
+    if ( !folders.IsEmpty() )
+    {
+        TArray< FAssetData > folder_asset_data_list;
+        subsystem->GetAssetsToValidate( folder_asset_data_list, folders );
+        asset_data_list.Append( MoveTemp( folder_asset_data_list ) );
+    }
+
+    // An asset requested twice would be reported as a duplicate name of itself
+    TSet< FSoftObjectPath > asset_paths;
+    asset_data_list.RemoveAll( [ & ]( const FAssetData & asset_data ) {
+        bool it_is_already_in_set = false;
+        asset_paths.Add( asset_data.GetSoftObjectPath(), &it_is_already_in_set );
+        return it_is_already_in_set;
+    } );
+
+    TArray< TSharedPtr< FJsonValue > > verdict_values;
+    verdict_values.Reserve( asset_data_list.Num() );
+
+    FNamingConventionValidationRun run( *subsystem, MoveTemp( asset_data_list ), false );
+    run.SetReportsToMessageLog( false );
+    run.SetOnVerdicts( [ & ]( const TConstArrayView< FNamingConventionValidationVerdict > verdicts ) {
+        for ( const auto & verdict : verdicts )
+        {
+            auto verdict_object = MakeShared< FJsonObject >();
+            FJsonObjectConverter::UStructToJsonObject( FNamingConventionValidationVerdict::StaticStruct(), &verdict, verdict_object );
+            verdict_values.Add( MakeShared< FJsonValueObject >( verdict_object ) );
+        }
+    } );
+    run.ProcessAssets();
+    const auto invalid_count = run.Finish();
+
+    response.SetStringField( TEXT( "status" ), TEXT( "ok" ) );
+    response.SetArrayField( TEXT( "verdicts" ), verdict_values );
+    response.SetArrayField( TEXT( "notFound" ), not_found_values );
+    response.SetNumberField( TEXT( "invalidCount" ), invalid_count );
+    response.SetNumberField( TEXT( "durationMs" ), ( FPlatformTime::Seconds() - start_time ) * 1000.0 );
+}
+
+void FNamingConventionValidationDaemon::QueueResponse( FConnection & connection, const TSharedRef< FJsonObject > & response ) const
+{
+    FString response_string;
+    FJsonSerializer::Serialize( response, TJsonWriterFactory< TCHAR, TCondensedJsonPrintPolicy< TCHAR > >::Create( &response_string ) );
+    response_string += TEXT( "\n" );
+
+    const FTCHARToUTF8 response_utf8( *response_string );
+    connection.PendingSendData.Append( reinterpret_cast< const uint8 * >( response_utf8.Get() ), response_utf8.Length() );
+}
+
+bool FNamingConventionValidationDaemon::SendPendingData( FConnection & connection ) const
+{
+    auto sent_total_size = 0;
+
+    while ( sent_total_size < connection.PendingSendData.Num() )
+    {
+        auto sent_size = 0;
+        if ( !connection.Socket->Send( connection.PendingSendData.GetData() + sent_total_size, connection.PendingSendData.Num() - sent_total_size, sent_size ) )
+        {
+            // The rest is sent when the client has read enough
+            if ( ISocketSubsystem::Get( PLATFORM_SOCKETSUBSYSTEM )->GetLastErrorCode() != SE_EWOULDBLOCK )
+            {
+                return false;
+            }
+
+            break;
+        }
+
+        if ( sent_size <= 0 )
+        {
+            break;
+        }
+
+        sent_total_size += sent_size;
+    }
+
+    connection.PendingSendData.RemoveAt( 0, sent_total_size, EAllowShrinking::No );
+
+    if ( connection.PendingSendData.Num() > MaxPendingSendSize )
+    {
+        UE_LOG( LogNamingConventionValidation, Warning, TEXT( "Closing a naming convention validation daemon connection which did not read %i bytes of responses" ), connection.PendingSendData.Num() );
+        return false;
+    }
+
+    return true;
+}
+
+void FNamingConventionValidationDaemon::CloseConnection( FConnection & connection ) const
+{
+    if ( connection.Socket != nullptr )
+    {
+        connection.Socket->Close();
+        ISocketSubsystem::Get( PLATFORM_SOCKETSUBSYSTEM )->DestroySocket( connection.Socket );
+        connection.Socket = nullptr;
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <CoreMinimal.h>
+#include <IDirectoryWatcher.h>
+
+class FJsonObject;
+class FSocket;
+
+// Keeps the asset registry, the settings, the rules and the validators loaded in a commandlet, and answers the validation requests of local clients.
+// The requests and the responses are JSON objects, one per line :
+// { "id": 1, "command": "validate", "paths": [ "/Game/Characters", "/Game/Weapons/BP_Rifle", "D:/Project/Content/Maps/Arena.umap" ] }
+// { "id": 2, "command": "ping" }
+// { "id": 3, "command": "shutdown" }
+class FNamingConventionValidationDaemon
+{
+public:
+    UE_NONCOPYABLE( FNamingConventionValidationDaemon );
+
+    explicit FNamingConventionValidationDaemon( int32 port );
+    ~FNamingConventionValidationDaemon();
+
+    // Scans the assets of the project, and listens to the port on the loopback address only. Returns false if the port can not be used
+    bool Start();
+    // Returns when a client sends the shutdown command, or when the engine is requested to exit
+    void Run();
+
+private:
+    struct FConnection
+    {
+        FSocket * Socket = nullptr;
+        TArray< uint8 > ReceivedData;
+        // The responses the client did not read yet, the sockets never block the daemon
+        TArray< uint8 > PendingSendData;
+    };
+
+    void WatchContentDirectories();
+    void UnwatchContentDirectories();
+    void OnDirectoryChanged( const TArray< FFileChangeData > & file_changes );
+    void ScanChangedFiles();
+    void AcceptConnections();
+    // Returns false when the connection must be closed
+    bool ProcessConnection( FConnection & connection );
+    TSharedRef< FJsonObject > ProcessRequest( const FString & request_string );
+    void Validate( FJsonObject & response, const FJsonObject & request ) const;
+    void QueueResponse( FConnection & connection, const TSharedRef< FJsonObject > & response ) const;
+    // Returns false when the connection must be closed
+    bool SendPendingData( FConnection & connection ) const;
+    void CloseConnection( FConnection & connection ) const;
+
+    int32 Port;
+    FSocket * ListenSocket;
+    TArray< FConnection > Connections;
+    TMap< FString, FDelegateHandle > WatchedDirectories;
+    TSet< FString > ChangedFiles;
+    bool ItIsShutdownRequested;
+    // The objects loaded by a validation are released before the next one
+    bool ItNeedsGarbageCollection;
+};
@@ -0,0 +1,72 @@
+#include "NamingConventionValidationDuplicateNameIndex.h"
+
+#include <AssetRegistry/AssetData.h>
+
+FNamingConventionValidationDuplicateNameIndex::FNamingConventionValidationDuplicateNameIndex( const bool scope_by_class ) :
+    PackageCount( 0 ),
+    ItIsScopedByClass( scope_by_class )
+{
+}
+
+void FNamingConventionValidationDuplicateNameIndex::Reset( const bool scope_by_class )
+{
+    PackagesByName.Reset();
+    PackageCount = 0;
+    ItIsScopedByClass = scope_by_class;
+}
+
+void FNamingConventionValidationDuplicateNameIndex::Reserve( const int32 asset_count )
+{
+    PackagesByName.Reserve( asset_count );
+}
+
+FName FNamingConventionValidationDuplicateNameIndex::Add( const FAssetData & asset_data )
+{
+    auto & packages = PackagesByName.FindOrAdd( MakeKey( asset_data.AssetName, asset_data.AssetClassPath ) );
+
+    if ( !packages.Contains( asset_data.PackageName ) )
+    {
+        packages.Add( asset_data.PackageName );
+        ++PackageCount;
+    }
+
+    for ( const auto package_name : packages )
+    {
+        if ( package_name != asset_data.PackageName )
+        {
+            return package_name;
+        }
+    }
+
+    return NAME_None;
+}
+
+void FNamingConventionValidationDuplicateNameIndex::Remove( const FName package_name, const FName asset_name, const FTopLevelAssetPath & asset_class_path )
+{
+    const auto key = MakeKey( asset_name, asset_class_path );
+
+    if ( auto * packages = PackagesByName.Find( key ) )
+    {
+        PackageCount -= packages->RemoveSwap( package_name );
+
+        if ( packages->IsEmpty() )
+        {
+            PackagesByName.Remove( key );
+        }
+    }
+}
+
+bool FNamingConventionValidationDuplicateNameIndex::IsScopedByClass() const
+{
+    return ItIsScopedByClass;
+}
+
+int32 FNamingConventionValidationDuplicateNameIndex::Num() const
+{
+    return PackageCount;
+}
+
+FNamingConventionValidationDuplicateNameIndex::FKey FNamingConventionValidationDuplicateNameIndex::MakeKey( const FName asset_name, const FTopLevelAssetPath & asset_class_path ) const
+{
+    return FKey { asset_name, ItIsScopedByClass ? asset_class_path : FTopLevelAssetPath() };
+}
@@ -0,0 +1,165 @@
+#include "NamingConventionValidationFrontendFilter.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationRun.h"
+
+#include <ContentBrowserItem.h>
+#include <Editor.h>
+
+#define LOCTEXT_NAMESPACE "NamingConventionValidationModule"
+
+FNamingConventionValidationFrontendFilter::FNamingConventionValidationFrontendFilter( TSharedPtr< FFrontendFilterCategory > category ) :
+    FFrontendFilter( category )
+{
+}
+
+FString FNamingConventionValidationFrontendFilter::GetName() const
+{
+    return TEXT( "NamingConventionViolations" );
+}
+
+FText FNamingConventionValidationFrontendFilter::GetDisplayName() const
+{
+    return LOCTEXT( "NamingConventionViolationsFilter", "Naming Convention Violations" );
+}
+
+FText FNamingConventionValidationFrontendFilter::GetToolTipText() const
+{
+    return LOCTEXT( "NamingConventionViolationsFilterTooltip", "Show only the assets which do not match the naming convention. The assets which were not validated yet are validated in the background." );
+}
+
+FLinearColor FNamingConventionValidationFrontendFilter::GetColor() const
+{
+    return FLinearColor::Red;
+}
+
+void FNamingConventionValidationFrontendFilter::ActiveStateChanged( const bool active )
+{
+    auto * editor_validation_subsystem = GEditor != nullptr ? GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() : nullptr;
+
+    if ( active )
+    {
+        if ( editor_validation_subsystem != nullptr && !ValidationResultsChangedHandle.IsValid() )
+        {
+            ValidationResultsChangedHandle = editor_validation_subsystem->OnValidationResultsChanged().AddSP( this, &FNamingConventionValidationFrontendFilter::OnValidationResultsChanged );
+        }
+        return;
+    }
+
+    if ( editor_validation_subsystem != nullptr )
+    {
+        editor_validation_subsystem->OnValidationResultsChanged().Remove( ValidationResultsChangedHandle );
+    }
+    ValidationResultsChangedHandle.Reset();
+
+    if ( ValidateStaleAssetsTickerHandle.IsValid() )
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker( ValidateStaleAssetsTickerHandle );
+        ValidateStaleAssetsTickerHandle.Reset();
+    }
+
+    if ( BroadcastChangedEventTickerHandle.IsValid() )
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker( BroadcastChangedEventTickerHandle );
+        BroadcastChangedEventTickerHandle.Reset();
+    }
+
+    if ( const auto run = StaleAssetsRun.Pin() )
+    {
+        run->Cancel();
+    }
+
+    StaleAssets.Reset();
+    StalePackageNames.Reset();
+}
+
+bool FNamingConventionValidationFrontendFilter::PassesFilter( const FAssetFilterType item ) const
+{
+    FAssetData asset_data;
+    if ( !item.Legacy_TryGetAssetData( asset_data ) )
+    {
+        return false;
+    }
+
+    const auto * editor_validation_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
+    if ( editor_validation_subsystem == nullptr )
+    {
+        return false;
+    }
+
+    const auto & validation_results = editor_validation_subsystem->GetValidationResults();
+    const auto * result = validation_results.Find( asset_data.PackageName );
+
+    if ( result == nullptr || validation_results.IsStale( *result ) )
+    {
+        // Validated on the next tick, once the filtering is done
+        if ( !StaleAssetsRun.IsValid() && !StalePackageNames.Contains( asset_data.PackageName ) )
+        {
+            StalePackageNames.Add( asset_data.PackageName );
+            StaleAssets.Add( asset_data );
+
+            if ( !ValidateStaleAssetsTickerHandle.IsValid() )
+            {
+                auto * self = const_cast< FNamingConventionValidationFrontendFilter * >( this );
+                ValidateStaleAssetsTickerHandle = FTSTicker::GetCoreTicker().AddTicker( FTickerDelegate::CreateSP( self, &FNamingConventionValidationFrontendFilter::ValidateStaleAssets ) );
+            }
+        }
+    }
+
+    // Stale results are still shown until they are refreshed
+    return result != nullptr && result->Result == ENamingConventionValidationResult::Invalid;
+}
+
+bool FNamingConventionValidationFrontendFilter::ValidateStaleAssets( float /*delta_time*/ )
+{
+    ValidateStaleAssetsTickerHandle.Reset();
+    StalePackageNames.Reset();
+
+    auto * editor_validation_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
+    if ( editor_validation_subsystem == nullptr || StaleAssets.IsEmpty() )
+    {
+        StaleAssets.Reset();
+        return false;
+    }
+
+    const auto run = editor_validation_subsystem->ValidateAssetsInBackground( MoveTemp( StaleAssets ), false );
+    run->SetReportsToMessageLog( false );
+
+    TWeakPtr< FNamingConventionValidationFrontendFilter > weak_this( StaticCastSharedRef< FNamingConventionValidationFrontendFilter >( AsShared() ) );
+
+    // The filter is applied again by OnValidationResultsChanged when the run changes the results
+    run->SetOnFinished( [ weak_this ]( const int32 /*invalid_count*/, const bool /*was_cancelled*/ ) {
+        if ( const auto filter = weak_this.Pin() )
+        {
+            // The assets which became stale during the run can be gathered again by the next filtering
+            filter->StaleAssetsRun.Reset();
+        }
+    } );
+
+    StaleAssetsRun = run;
+    StaleAssets.Reset();
+
+    return false;
+}
+
+void FNamingConventionValidationFrontendFilter::OnValidationResultsChanged()
+{
+    if ( !BroadcastChangedEventTickerHandle.IsValid() )
+    {
+        BroadcastChangedEventTickerHandle = FTSTicker::GetCoreTicker().AddTicker( FTickerDelegate::CreateSP( this, &FNamingConventionValidationFrontendFilter::BroadcastResultsChanged ) );
+    }
+}
+
+bool FNamingConventionValidationFrontendFilter::BroadcastResultsChanged( float /*delta_time*/ )
+{
+    BroadcastChangedEventTickerHandle.Reset();
+    BroadcastChangedEvent();
+    return false;
+}
+
+void UNamingConventionValidationFrontEndFilterExtension::AddFrontEndFilterExtensions( TSharedPtr< FFrontendFilterCategory > default_category, TArray< TSharedRef< FFrontendFilter > > & filter_list ) const
+{
+    filter_list.Add( MakeShared< FNamingConventionValidationFrontendFilter >( default_category ) );
+}
+
+#undef LOCTEXT_NAMESPACE
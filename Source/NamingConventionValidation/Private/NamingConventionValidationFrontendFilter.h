@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Containers/Ticker.h>
+#include <ContentBrowserFrontEndFilterExtension.h>
+#include <CoreMinimal.h>
+#include <FrontendFilterBase.h>
+
+#include "NamingConventionValidationFrontendFilter.generated.h"
+
+class FNamingConventionValidationRun;
+
+// Shows the assets which do not match the naming convention, using the results of the previous validations.
+// The assets without results, or with stale results, are validated in the background.
+// The filter is applied again when the results change, whichever validation changed them
+class FNamingConventionValidationFrontendFilter final : public FFrontendFilter
+{
+public:
+    explicit FNamingConventionValidationFrontendFilter( TSharedPtr< FFrontendFilterCategory > category );
+
+    FString GetName() const override;
+    FText GetDisplayName() const override;
+    FText GetToolTipText() const override;
+    FLinearColor GetColor() const override;
+    void ActiveStateChanged( bool active ) override;
+    bool PassesFilter( FAssetFilterType item ) const override;
+
+private:
+    bool ValidateStaleAssets( float delta_time );
+    void OnValidationResultsChanged();
+    bool BroadcastResultsChanged( float delta_time );
+
+    // Gathered while filtering, which must stay cheap
+    mutable TArray< FAssetData > StaleAssets;
+    mutable TSet< FName > StalePackageNames;
+    mutable FTSTicker::FDelegateHandle ValidateStaleAssetsTickerHandle;
+    TWeakPtr< FNamingConventionValidationRun > StaleAssetsRun;
+    FDelegateHandle ValidationResultsChangedHandle;
+    // The results of a whole run change the filter only once, on the next tick
+    FTSTicker::FDelegateHandle BroadcastChangedEventTickerHandle;
+};
+
+UCLASS()
+class UNamingConventionValidationFrontEndFilterExtension final : public UContentBrowserFrontEndFilterExtension
+{
+    GENERATED_BODY()
+
+public:
+    void AddFrontEndFilterExtensions( TSharedPtr< FFrontendFilterCategory > default_category, TArray< TSharedRef< FFrontendFilter > > & filter_list ) const override;
+};
@@ -0,0 +1,171 @@
+#include "NamingConventionValidationImpact.h"
+
+#include "NamingConventionValidationSettings.h"
+
+namespace
+{
+    FString GetResultString( const ENamingConventionValidationResult result, const FName rule_id )
+    {
+        const auto result_string = StaticEnum< ENamingConventionValidationResult >()->GetNameStringByValue( static_cast< int64 >( result ) );
+        return rule_id.IsNone() ? result_string : FString::Printf( TEXT( "%s (%s)" ), *result_string, *rule_id.ToString() );
+    }
+}
+
+void FNamingConventionValidationImpactSnapshot::Reset()
+{
+    AssetDataList.Reset();
+    AssetClassPaths.Reset();
+    AssetIndices.Reset();
+}
+
+void FNamingConventionValidationImpactSnapshot::Reserve( const int32 asset_count )
+{
+    AssetDataList.Reserve( asset_count );
+    AssetClassPaths.Reserve( asset_count );
+    AssetIndices.Reserve( asset_count );
+}
+
+void FNamingConventionValidationImpactSnapshot::Add( const FAssetData & asset_data, const FTopLevelAssetPath & asset_class_path )
+{
+    if ( asset_data.IsRedirector() )
+    {
+        return;
+    }
+
+    TStringBuilder< 256 > package_name;
+    asset_data.PackageName.AppendString( package_name );
+
+    if ( UNamingConventionValidationSettings::IsExternalActorPath( package_name.ToView() ) || UNamingConventionValidationSettings::IsExternalObjectPath( package_name.ToView() ) )
+    {
+        return;
+    }
+
+    // The tags are not kept, the class was resolved from them
+    FAssetData compact_asset_data( asset_data.PackageName, asset_data.PackagePath, asset_data.AssetName, asset_data.AssetClassPath );
+
+    if ( const auto * asset_index = AssetIndices.Find( asset_data.GetSoftObjectPath() ) )
+    {
+        AssetDataList[ *asset_index ] = MoveTemp( compact_asset_data );
+        AssetClassPaths[ *asset_index ] = asset_class_path;
+        return;
+    }
+
+    AssetIndices.Add( asset_data.GetSoftObjectPath(), AssetDataList.Num() );
+    AssetDataList.Add( MoveTemp( compact_asset_data ) );
+    AssetClassPaths.Add( asset_class_path );
+}
+
+void FNamingConventionValidationImpactSnapshot::Remove( const FSoftObjectPath & object_path )
+{
+    int32 asset_index;
+    if ( !AssetIndices.RemoveAndCopyValue( object_path, asset_index ) )
+    {
+        return;
+    }
+
+    AssetDataList.RemoveAtSwap( asset_index, 1, EAllowShrinking::No );
+    AssetClassPaths.RemoveAtSwap( asset_index, 1, EAllowShrinking::No );
+
+    // The last asset took the place of the removed one
+    if ( AssetDataList.IsValidIndex( asset_index ) )
+    {
+        AssetIndices[ AssetDataList[ asset_index ].GetSoftObjectPath() ] = asset_index;
+    }
+}
+
+int32 FNamingConventionValidationImpactSnapshot::Num() const
+{
+    return AssetDataList.Num();
+}
+
+TConstArrayView< FAssetData > FNamingConventionValidationImpactSnapshot::GetAssetDataList() const
+{
+    return AssetDataList;
+}
+
+TConstArrayView< FTopLevelAssetPath > FNamingConventionValidationImpactSnapshot::GetAssetClassPaths() const
+{
+    return AssetClassPaths;
+}
+
+FString FNamingConventionImpactChange::ToString() const
+{
+    return FString::Printf( TEXT( "%s : %s -> %s" ), *PackageName.ToString(), *GetResultString( PreviousResult, PreviousRuleId ), *GetResultString( Result, RuleId ) );
+}
+
+void FNamingConventionSettingsImpact::Reset()
+{
+    *this = FNamingConventionSettingsImpact();
+}
+
+void FNamingConventionSettingsImpact::AddVerdicts( const FName package_name, const ENamingConventionValidationResult previous_result, const FName previous_rule_id, const ENamingConventionValidationResult result, const FName rule_id )
+{
+    if ( previous_result == result && previous_rule_id == rule_id )
+    {
+        return;
+    }
+
+    Changes.Add( { package_name, previous_result, previous_rule_id, result, rule_id } );
+
+    const auto was_invalid = previous_result == ENamingConventionValidationResult::Invalid;
+    const auto is_invalid = result == ENamingConventionValidationResult::Invalid;
+
+    // An asset which fails another rule fixes the violation of the previous rule for that rule
+    if ( was_invalid )
+    {
+        ++RuleImpacts.FindOrAdd( previous_rule_id ).FixedViolationCount;
+    }
+
+    if ( is_invalid )
+    {
+        ++RuleImpacts.FindOrAdd( rule_id ).NewViolationCount;
+    }
+
+    if ( was_invalid && !is_invalid )
+    {
+        ++FixedViolationCount;
+    }
+    else if ( !was_invalid && is_invalid )
+    {
+        ++NewViolationCount;
+    }
+
+    if ( previous_result != ENamingConventionValidationResult::Excluded && result == ENamingConventionValidationResult::Excluded )
+    {
+        ++NewlyExcludedCount;
+    }
+    else if ( previous_result == ENamingConventionValidationResult::Excluded && result != ENamingConventionValidationResult::Excluded )
+    {
+        ++NewlyIncludedCount;
+    }
+}
+
+void FNamingConventionSettingsImpact::GetReportLines( TArray< FString > & lines ) const
+{
+    lines.Add( FString::Printf( TEXT( "%i assets evaluated in %.2f seconds, %i assets change : %i new violations, %i fixed violations, %i newly excluded, %i newly included" ),
+        AssetCount,
+        Seconds,
+        Changes.Num(),
+        NewViolationCount,
+        FixedViolationCount,
+        NewlyExcludedCount,
+        NewlyIncludedCount ) );
+
+    if ( UnresolvedClassCount > 0 )
+    {
+        lines.Add( FString::Printf( TEXT( "%i assets whose class is not loaded were not evaluated" ), UnresolvedClassCount ) );
+    }
+
+    if ( InvalidClassDescriptionCount > 0 )
+    {
+        lines.Add( FString::Printf( TEXT( "%i class descriptions of the candidate settings have no valid class and were ignored" ), InvalidClassDescriptionCount ) );
+    }
+
+    auto rule_impacts = RuleImpacts;
+    rule_impacts.KeySort( FNameLexicalLess() );
+
+    for ( const auto & [ rule_id, rule_impact ] : rule_impacts )
+    {
+        lines.Add( FString::Printf( TEXT( "%s : +%i -%i" ), *rule_id.ToString(), rule_impact.NewViolationCount, rule_impact.FixedViolationCount ) );
+    }
+}
@@ -0,0 +1,100 @@
+#include "NamingConventionValidationMemory.h"
+
+#include <HAL/PlatformMemory.h>
+
+LLM_DEFINE_TAG( NamingConventionValidation );
+
+namespace
+{
+    thread_local FNamingConventionValidationMemoryStats * CurrentMemoryStats = nullptr;
+}
+
+FNamingConventionValidationMemoryStats::FScope::FScope( FNamingConventionValidationMemoryStats * stats ) :
+    PreviousStats( CurrentMemoryStats )
+{
+    CurrentMemoryStats = stats;
+}
+
+FNamingConventionValidationMemoryStats::FScope::~FScope()
+{
+    CurrentMemoryStats = PreviousStats;
+}
+
+FNamingConventionValidationScratchScope::FNamingConventionValidationScratchScope() :
+    Mark( FMemStack::Get() ),
+    StartByteCount( FMemStack::Get().GetByteCount() ),
+    Stats( FNamingConventionValidationMemoryStats::GetCurrent() )
+{
+}
+
+FNamingConventionValidationScratchScope::~FNamingConventionValidationScratchScope()
+{
+    if ( Stats != nullptr )
+    {
+        // Sampled before the mark releases the data of the scope
+        Stats->AddScratchScopeByteCount( FMemStack::Get().GetByteCount() - StartByteCount );
+    }
+}
+
+FNamingConventionValidationMemoryStats::FNamingConventionValidationMemoryStats() :
+    ScratchAllocationCount( 0 ),
+    ScratchPeakByteCount( 0 )
+{
+    Reset();
+}
+
+FNamingConventionValidationMemoryStats * FNamingConventionValidationMemoryStats::GetCurrent()
+{
+    return CurrentMemoryStats;
+}
+
+void FNamingConventionValidationMemoryStats::Reset()
+{
+    const auto memory_stats = FPlatformMemory::GetStats();
+
+    StartUsedPhysical = memory_stats.UsedPhysical;
+    PeakUsedPhysical = memory_stats.UsedPhysical;
+
+    ScratchAllocationCount.store( 0, std::memory_order_relaxed );
+    ScratchPeakByteCount.store( 0, std::memory_order_relaxed );
+}
+
+void FNamingConventionValidationMemoryStats::Sample()
+{
+    PeakUsedPhysical = FMath::Max< uint64 >( PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical );
+}
+
+void FNamingConventionValidationMemoryStats::AddScratchAllocation()
+{
+    ScratchAllocationCount.fetch_add( 1, std::memory_order_relaxed );
+}
+
+void FNamingConventionValidationMemoryStats::AddScratchScopeByteCount( const int64 byte_count )
+{
+    auto peak_byte_count = ScratchPeakByteCount.load( std::memory_order_relaxed );
+    while ( byte_count > peak_byte_count && !ScratchPeakByteCount.compare_exchange_weak( peak_byte_count, byte_count, std::memory_order_relaxed ) )
+    {
+    }
+}
+
+int64 FNamingConventionValidationMemoryStats::GetPeakUsedPhysical() const
+{
+    return static_cast< int64 >( PeakUsedPhysical );
+}
+
+void FNamingConventionValidationMemoryStats::GetReportLines( TArray< FString > & lines, const int32 asset_count ) const
+{
+    static const double BytesPerMegabyte = 1024.0 * 1024.0;
+
+    // The memory of the process also grows with the work of the editor during the run, so it is not divided by the assets
+    lines.Add( FString::Printf( TEXT( "Peak memory of the process : %.1f MB, %.1f MB more than at the start of the validation" ),
+        PeakUsedPhysical / BytesPerMegabyte,
+        ( PeakUsedPhysical - StartUsedPhysical ) / BytesPerMegabyte ) );
+
+    const auto scratch_allocation_count = ScratchAllocationCount.load( std::memory_order_relaxed );
+
+    lines.Add( FString::Printf( TEXT( "Scratch allocations of the validation : %lld, %.1f per asset. Peak of a scratch scope : %.1f KB" ),
+        scratch_allocation_count,
+        asset_count > 0 ? static_cast< double >( scratch_allocation_count ) / asset_count : 0.0,
+        ScratchPeakByteCount.load( std::memory_order_relaxed ) / 1024.0 ) );
+}
@@ -0,0 +1,153 @@
+#include "NamingConventionValidationMessageGroups.h"
+
+#include <AssetRegistry/AssetData.h>
+#include <Logging/MessageLog.h>
+#include <Logging/TokenizedMessage.h>
+#include <Misc/UObjectToken.h>
+
+#define LOCTEXT_NAMESPACE "NamingConventionValidationManager"
+
+namespace
+{
+    // The groups with that many assets or less are listed asset by asset, the other ones show that many examples
+    constexpr int32 ExampleCount = 3;
+}
+
+void FNamingConventionValidationMessageGroups::Add( const EKind kind, const FName rule_id, const FAssetData & asset_data, const FText & message )
+{
+    const FGroupKey key { kind, rule_id, asset_data.PackagePath };
+
+    auto * entries = Groups.Find( key );
+    if ( entries == nullptr )
+    {
+        entries = &Groups.Add( key, MakeShared< TArray< FEntry > >() );
+    }
+
+    ( *entries )->Add( { asset_data.PackageName, message } );
+}
+
+void FNamingConventionValidationMessageGroups::Flush( FMessageLog & data_validation_log )
+{
+    // Always listed in the same order, whatever the order of the validation
+    Groups.KeySort( []( const FGroupKey & left, const FGroupKey & right ) {
+        if ( left.Kind != right.Kind )
+        {
+            return left.Kind < right.Kind;
+        }
+        if ( left.Folder != right.Folder )
+        {
+            return left.Folder.LexicalLess( right.Folder );
+        }
+        return left.RuleId.LexicalLess( right.RuleId );
+    } );
+
+    for ( const auto & [ key, entries ] : Groups )
+    {
+        if ( entries->Num() <= ExampleCount )
+        {
+            for ( const auto & entry : *entries )
+            {
+                AddAssetMessage( data_validation_log, key.Kind, entry );
+            }
+            continue;
+        }
+
+        FFormatNamedArguments arguments;
+        arguments.Add( TEXT( "Count" ), entries->Num() );
+        arguments.Add( TEXT( "Folder" ), FText::FromName( key.Folder ) );
+        arguments.Add( TEXT( "RuleId" ), FText::FromName( key.RuleId ) );
+        arguments.Add( TEXT( "OtherCount" ), entries->Num() - ExampleCount );
+
+        TSharedPtr< FTokenizedMessage > message;
+        switch ( key.Kind )
+        {
+            case EKind::Excluded:
+            {
+                message = data_validation_log.Info( FText::Format( LOCTEXT( "ExcludedGroup", "{Count} assets in {Folder} have not been tested based on the configuration :" ), arguments ) );
+            }
+            break;
+            case EKind::KnownViolation:
+            {
+                message = data_validation_log.Info( FText::Format( LOCTEXT( "KnownViolationGroup", "{Count} assets in {Folder} are known violations of the naming convention rule {RuleId} :" ), arguments ) );
+            }
+            break;
+            case EKind::Unknown:
+            {
+                message = data_validation_log.Warning( FText::Format( LOCTEXT( "UnknownGroup", "{Count} assets of class {RuleId} in {Folder} have no known naming convention :" ), arguments ) );
+            }
+            break;
+            case EKind::NotEvaluated:
+            {
+                message = data_validation_log.Warning( FText::Format( LOCTEXT( "NotEvaluatedGroup", "{Count} assets in {Folder} were not evaluated by the validator {RuleId}, disabled for exceeding its time budget :" ), arguments ) );
+            }
+            break;
+        }
+
+        for ( auto index = 0; index < ExampleCount; ++index )
+        {
+            message->AddToken( FAssetNameToken::Create( ( *entries )[ index ].PackageName.ToString() ) );
+        }
+
+        const auto kind = key.Kind;
+        message->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "OtherAssetsInGroup", "and {OtherCount} other assets." ), arguments ) ) );
+        message->AddToken( FActionToken::Create(
+            LOCTEXT( "ShowGroupAssets", "Show all" ),
+            LOCTEXT( "ShowGroupAssetsTooltip", "Adds a message for each asset of the group to the log" ),
+            FOnActionTokenExecuted::CreateLambda( [ kind, group_entries = entries ]() {
+                FMessageLog group_log( "NamingConventionValidation" );
+                for ( const auto & entry : *group_entries )
+                {
+                    AddAssetMessage( group_log, kind, entry );
+                }
+            } ),
+            true ) );
+    }
+
+    Groups.Reset();
+}
+
+bool FNamingConventionValidationMessageGroups::IsEmpty() const
+{
+    return Groups.IsEmpty();
+}
+
+void FNamingConventionValidationMessageGroups::AddAssetMessage( FMessageLog & data_validation_log, const EKind kind, const FEntry & entry )
+{
+    switch ( kind )
+    {
+        case EKind::Excluded:
+        {
+            data_validation_log.Info()
+                ->AddToken( FAssetNameToken::Create( entry.PackageName.ToString() ) )
+                ->AddToken( FTextToken::Create( LOCTEXT( "ExcludedNamingConventionResult", "has not been tested based on the configuration." ) ) )
+                ->AddToken( FTextToken::Create( entry.Message ) );
+        }
+        break;
+        case EKind::KnownViolation:
+        {
+            data_validation_log.Info()
+                ->AddToken( FAssetNameToken::Create( entry.PackageName.ToString() ) )
+                ->AddToken( FTextToken::Create( LOCTEXT( "KnownViolationNamingConventionResult", "is a known naming convention violation." ) ) )
+                ->AddToken( FTextToken::Create( entry.Message ) );
+        }
+        break;
+        case EKind::Unknown:
+        {
+            data_validation_log.Warning()
+                ->AddToken( FAssetNameToken::Create( entry.PackageName.ToString() ) )
+                ->AddToken( FTextToken::Create( LOCTEXT( "UnknownNamingConventionResult", "has no known naming convention." ) ) )
+                ->AddToken( FTextToken::Create( entry.Message ) );
+        }
+        break;
+        case EKind::NotEvaluated:
+        {
+            data_validation_log.Warning()
+                ->AddToken( FAssetNameToken::Create( entry.PackageName.ToString() ) )
+                ->AddToken( FTextToken::Create( LOCTEXT( "NotEvaluatedNamingConventionResult", "was not evaluated by a validator disabled for exceeding its time budget." ) ) )
+                ->AddToken( FTextToken::Create( entry.Message ) );
+        }
+        break;
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
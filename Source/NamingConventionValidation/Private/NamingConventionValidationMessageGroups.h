@@ -0,0 +1,55 @@
+#pragma once
+
+#include <CoreMinimal.h>
+
+class FMessageLog;
+struct FAssetData;
+
+// Groups the messages of the validated assets by kind, rule and folder, to add a single message per group to the message log instead of one per asset.
+// The messages of the assets of a group are only created when the group is expanded from the message log
+class FNamingConventionValidationMessageGroups
+{
+public:
+    enum class EKind : uint8
+    {
+        Excluded,
+        KnownViolation,
+        Unknown,
+        // The rule is the validator the time budget disabled
+        NotEvaluated
+    };
+
+    void Add( EKind kind, FName rule_id, const FAssetData & asset_data, const FText & message );
+    // Adds the groups to the log, then empties them
+    void Flush( FMessageLog & data_validation_log );
+    bool IsEmpty() const;
+
+private:
+    struct FGroupKey
+    {
+        bool operator==( const FGroupKey & other ) const
+        {
+            return Kind == other.Kind && RuleId == other.RuleId && Folder == other.Folder;
+        }
+
+        friend uint32 GetTypeHash( const FGroupKey & key )
+        {
+            return HashCombine( HashCombine( ::GetTypeHash( key.Kind ), GetTypeHash( key.RuleId ) ), GetTypeHash( key.Folder ) );
+        }
+
+        EKind Kind;
+        FName RuleId;
+        FName Folder;
+    };
+
+    struct FEntry
+    {
+        FName PackageName;
+        FText Message;
+    };
+
+    static void AddAssetMessage( FMessageLog & data_validation_log, EKind kind, const FEntry & entry );
+
+    // Shared with the action which expands the group
+    TMap< FGroupKey, TSharedRef< TArray< FEntry > > > Groups;
+};
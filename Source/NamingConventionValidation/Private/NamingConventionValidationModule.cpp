@@ -2,6 +2,9 @@
 
 #include "EditorNamingValidatorSubsystem.h"
 #include "NamingConventionValidationCommandlet.h"
+#include "NamingConventionValidationCook.h"
+#include "NamingConventionValidationSettings.h"
+#include "SNamingConventionValidationImpactPanel.h"
 
 #include <AssetRegistry/AssetRegistryModule.h>
 #include <AssetToolsModule.h>
@@ -11,14 +14,18 @@
 #include <Framework/Application/SlateApplication.h>
 #include <Framework/MultiBox/MultiBoxBuilder.h>
 #include <Framework/MultiBox/MultiBoxExtender.h>
+#include <Framework/Docking/TabManager.h>
 #include <LevelEditor.h>
 #include <Misc/MessageDialog.h>
 #include <Modules/ModuleManager.h>
 #include <UObject/Object.h>
 #include <UObject/ObjectSaveContext.h>
+#include <Widgets/Docking/SDockTab.h>
 
 #define LOCTEXT_NAMESPACE "NamingConventionValidationModule"
 
+static const FName ImpactAnalysisTabName( TEXT( "NamingConventionImpactAnalysis" ) );
+
 void FindAssetDependencies( const FAssetRegistryModule & asset_registry_module, const FAssetData & asset_data, TSet< FAssetData > & dependent_assets )
 {
     if ( asset_data.IsValid() )
@@ -69,20 +76,20 @@ void ValidateAssets( const TArray< FAssetData > selected_assets )
 
 void ValidateFolders( const TArray< FString > selected_folders )
 {
-    auto & asset_registry_module = FModuleManager::Get().LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
-
-    FARFilter filter;
-    filter.bRecursivePaths = true;
-
-    for ( const auto & folder : selected_folders )
+    if ( auto * editor_validation_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() )
     {
-        filter.PackagePaths.Emplace( *folder );
-    }
-
-    TArray< FAssetData > asset_list;
-    asset_registry_module.Get().GetAssets( filter, asset_list );
+        TArray< FAssetData > asset_list;
+        editor_validation_subsystem->GetAssetsToValidate( asset_list, selected_folders );
 
-    ValidateAssets( asset_list );
+        if ( GetDefault< UNamingConventionValidationSettings >()->bValidateFoldersInBackground )
+        {
+            editor_validation_subsystem->ValidateAssetsInBackground( MoveTemp( asset_list ) );
+        }
+        else
+        {
+            editor_validation_subsystem->ValidateAssets( asset_list );
+        }
+    }
 }
 
 void CreateDataValidationContentBrowserAssetMenu( FMenuBuilder & menu_builder, const TArray< FAssetData > selected_assets )
@@ -151,6 +158,13 @@ void MenuValidateData()
     }
 
     TArray< FString > paths = { TEXT( "/Game" ) };
+
+    if ( GetDefault< UNamingConventionValidationSettings >()->bValidateFoldersInBackground )
+    {
+        ValidateFolders( paths );
+        return;
+    }
+
     const auto success = UNamingConventionValidationCommandlet::ValidateData( paths );
 
     if ( !success )
@@ -159,6 +173,20 @@ void MenuValidateData()
     }
 }
 
+TSharedRef< SDockTab > SpawnImpactAnalysisTab( const FSpawnTabArgs & /*spawn_tab_args*/ )
+{
+    return SNew( SDockTab )
+        .TabRole( ETabRole::NomadTab )
+        [
+            SNew( SNamingConventionValidationImpactPanel )
+        ];
+}
+
+void OpenImpactAnalysisTab()
+{
+    FGlobalTabmanager::Get()->TryInvokeTab( ImpactAnalysisTabName );
+}
+
 void NamingConventionValidationMenuCreationDelegate( FMenuBuilder & menu_builder )
 {
     menu_builder.BeginSection( "NamingConventionValidation", LOCTEXT( "NamingConventionValidation", "NamingConventionValidation" ) );
@@ -167,6 +195,11 @@ void NamingConventionValidationMenuCreationDelegate( FMenuBuilder & menu_builder
         LOCTEXT( "NamingConventionValidationTooltip", "Validates all naming convention in content directory." ),
         FSlateIcon( FAppStyle::GetAppStyleSetName(), "DeveloperTools.MenuIcon" ),
         FUIAction( FExecuteAction::CreateStatic( &MenuValidateData ) ) );
+    menu_builder.AddMenuEntry(
+        LOCTEXT( "NamingConventionImpactAnalysisTitle", "Naming Convention Settings Impact..." ),
+        LOCTEXT( "NamingConventionImpactAnalysisTooltip", "Shows which assets would start or stop failing the naming convention with other settings, without changing the settings." ),
+        FSlateIcon( FAppStyle::GetAppStyleSetName(), "DeveloperTools.MenuIcon" ),
+        FUIAction( FExecuteAction::CreateStatic( &OpenImpactAnalysisTab ) ) );
     menu_builder.EndSection();
 }
 
@@ -181,12 +214,18 @@ private:
     FDelegateHandle ContentBrowserAssetExtenderDelegateHandle;
     FDelegateHandle ContentBrowserPathExtenderDelegateHandle;
     FDelegateHandle OnPackageSavedDelegateHandle;
+    TUniquePtr< FNamingConventionValidationCook > CookValidation;
 };
 
 IMPLEMENT_MODULE( FNamingConventionValidationModule, NamingConventionValidation )
 
 void FNamingConventionValidationModule::StartupModule()
 {
+    if ( FNamingConventionValidationCook::IsEnabled() )
+    {
+        CookValidation = MakeUnique< FNamingConventionValidationCook >();
+    }
+
     if ( !IsRunningCommandlet() && !IsRunningGame() && FSlateApplication::IsInitialized() )
     {
         auto & content_browser_module = FModuleManager::LoadModuleChecked< FContentBrowserModule >( TEXT( "ContentBrowser" ) );
@@ -207,11 +246,17 @@ void FNamingConventionValidationModule::StartupModule()
         level_editor_module.GetMenuExtensibilityManager()->AddExtender( MenuExtender );
 
         OnPackageSavedDelegateHandle = UPackage::PackageSavedWithContextEvent.AddStatic( OnPackageSaved );
+
+        FGlobalTabmanager::Get()->RegisterNomadTabSpawner( ImpactAnalysisTabName, FOnSpawnTab::CreateStatic( &SpawnImpactAnalysisTab ) )
+            .SetDisplayName( LOCTEXT( "NamingConventionImpactAnalysisTabTitle", "Naming Convention Impact" ) )
+            .SetMenuType( ETabSpawnerMenuType::Hidden );
     }
 }
 
 void FNamingConventionValidationModule::ShutdownModule()
 {
+    CookValidation.Reset();
+
     if ( !IsRunningCommandlet() && !IsRunningGame() && !IsRunningDedicatedServer() )
     {
         if ( auto * content_browser_module = FModuleManager::GetModulePtr< FContentBrowserModule >( TEXT( "ContentBrowser" ) ) )
@@ -232,6 +277,11 @@ void FNamingConventionValidationModule::ShutdownModule()
         MenuExtender = nullptr;
 
         UPackage::PackageSavedWithContextEvent.Remove( OnPackageSavedDelegateHandle );
+
+        if ( FSlateApplication::IsInitialized() )
+        {
+            FGlobalTabmanager::Get()->UnregisterNomadTabSpawner( ImpactAnalysisTabName );
+        }
     }
 }
 
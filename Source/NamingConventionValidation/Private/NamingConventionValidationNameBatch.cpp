@@ -0,0 +1,163 @@
+#include "NamingConventionValidationNameBatch.h"
+
+namespace
+{
+    // The characters are compared 4 by 4, as 64 bits words
+    constexpr int32 CharactersPerWord = sizeof( uint64 ) / sizeof( TCHAR );
+    constexpr bool ItCanCompareWords = sizeof( TCHAR ) == 2;
+
+    constexpr uint64 NonAsciiMask = 0xFF80FF80FF80FF80ull;
+
+    // Lowercases the ASCII letters of the 4 characters of the word, which must all be ASCII.
+    // Adding to each character moves the ones from 'A' and the ones after 'Z' to the high bit of their low byte, without overflowing to the next character
+    uint64 ToLowerAsciiWord( const uint64 word )
+    {
+        const auto from_a = word + 0x003F003F003F003Full;
+        const auto after_z = word + 0x0025002500250025ull;
+        const auto uppercase = from_a & ~after_z & 0x0080008000800080ull;
+        return word | ( uppercase >> 2 );
+    }
+
+    uint64 LoadWord( const TCHAR * characters )
+    {
+        uint64 word;
+        FMemory::Memcpy( &word, characters, sizeof( word ) );
+        return word;
+    }
+
+    bool AreCharactersEqual( const TCHAR character, const TCHAR other_character, const ESearchCase::Type search_case )
+    {
+        return search_case == ESearchCase::CaseSensitive
+                   ? character == other_character
+                   : FChar::ToLower( character ) == FChar::ToLower( other_character );
+    }
+
+    // affix is already lowercased when the comparison ignores the case
+    bool AreEqual( const TCHAR * characters, const TCHAR * affix, const int32 length, const ESearchCase::Type search_case )
+    {
+        auto index = 0;
+
+        if constexpr ( ItCanCompareWords )
+        {
+            for ( ; index + CharactersPerWord <= length; index += CharactersPerWord )
+            {
+                const auto word = LoadWord( characters + index );
+                const auto affix_word = LoadWord( affix + index );
+
+                if ( search_case == ESearchCase::CaseSensitive )
+                {
+                    if ( word != affix_word )
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
+                if ( ( ( word | affix_word ) & NonAsciiMask ) == 0 )
+                {
+                    if ( ToLowerAsciiWord( word ) != affix_word )
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
+                for ( auto word_index = index; word_index < index + CharactersPerWord; ++word_index )
+                {
+                    if ( !AreCharactersEqual( characters[ word_index ], affix[ word_index ], search_case ) )
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        for ( ; index < length; ++index )
+        {
+            if ( !AreCharactersEqual( characters[ index ], affix[ index ], search_case ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+void FNamingConventionValidationNameBatch::Reset( const int32 name_count )
+{
+    // Most asset names fit in 32 characters
+    Characters.Reset( name_count * 32 );
+    Offsets.Reset( name_count );
+    Lengths.Reset( name_count );
+}
+
+int32 FNamingConventionValidationNameBatch::Add( const FName name, const FStringView suffix_to_remove )
+{
+    TStringBuilder< FName::StringBufferSize > name_string;
+    name.AppendString( name_string );
+
+    auto name_view = name_string.ToView();
+    if ( !suffix_to_remove.IsEmpty() && name_view.EndsWith( suffix_to_remove, ESearchCase::CaseSensitive ) )
+    {
+        name_view.LeftChopInline( suffix_to_remove.Len() );
+    }
+
+    Offsets.Add( Characters.Num() );
+    Lengths.Add( name_view.Len() );
+    Characters.Append( name_view.GetData(), name_view.Len() );
+
+    return Offsets.Num() - 1;
+}
+
+FStringView FNamingConventionValidationNameBatch::GetName( const int32 name_index ) const
+{
+    return FStringView( Characters.GetData() + Offsets[ name_index ], Lengths[ name_index ] );
+}
+
+int32 FNamingConventionValidationNameBatch::Num() const
+{
+    return Offsets.Num();
+}
+
+void FNamingConventionValidationNameBatch::MatchPrefix( TBitArray< FNamingConventionScratchAllocator > & matches, const TConstArrayView< int32 > name_indices, const FStringView prefix, const ESearchCase::Type search_case ) const
+{
+    MatchAffix( matches, name_indices, prefix, search_case, false );
+}
+
+void FNamingConventionValidationNameBatch::MatchSuffix( TBitArray< FNamingConventionScratchAllocator > & matches, const TConstArrayView< int32 > name_indices, const FStringView suffix, const ESearchCase::Type search_case ) const
+{
+    MatchAffix( matches, name_indices, suffix, search_case, true );
+}
+
+void FNamingConventionValidationNameBatch::MatchAffix( TBitArray< FNamingConventionScratchAllocator > & matches, const TConstArrayView< int32 > name_indices, const FStringView affix, const ESearchCase::Type search_case, const bool match_suffix ) const
+{
+    // The affix is lowercased once, instead of for each name
+    TStringBuilder< 64 > comparable_affix;
+    comparable_affix << affix;
+
+    if ( search_case == ESearchCase::IgnoreCase )
+    {
+        for ( auto index = 0; index < comparable_affix.Len(); ++index )
+        {
+            comparable_affix.GetData()[ index ] = FChar::ToLower( comparable_affix.GetData()[ index ] );
+        }
+    }
+
+    const auto affix_length = comparable_affix.Len();
+    const auto * characters = Characters.GetData();
+
+    for ( auto index = 0; index < name_indices.Num(); ++index )
+    {
+        const auto name_index = name_indices[ index ];
+        const auto name_length = Lengths[ name_index ];
+        if ( name_length < affix_length )
+        {
+            matches[ index ] = false;
+            continue;
+        }
+
+        const auto affix_offset = Offsets[ name_index ] + ( match_suffix ? name_length - affix_length : 0 );
+        matches[ index ] = AreEqual( characters + affix_offset, comparable_affix.GetData(), affix_length, search_case );
+    }
+}
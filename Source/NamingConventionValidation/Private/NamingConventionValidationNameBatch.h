@@ -0,0 +1,30 @@
+#pragma once
+
+#include "NamingConventionValidationMemory.h"
+
+#include <CoreMinimal.h>
+
+// Names of a batch of assets stored contiguously, one offset and one length per name, to check the affixes of many names at once
+class FNamingConventionValidationNameBatch
+{
+public:
+    void Reset( int32 name_count );
+
+    // suffix_to_remove is removed from the end of the name when it's there, with a case sensitive comparison
+    int32 Add( FName name, FStringView suffix_to_remove = FStringView() );
+    FStringView GetName( int32 name_index ) const;
+    int32 Num() const;
+
+    // Sets the bit of matches of each name of name_indices to whether it starts with the prefix. matches must have one bit per index of name_indices,
+    // so several threads can match different names of the batch at the same time. matches is transient, so it lives in the scratch arena of the thread
+    void MatchPrefix( TBitArray< FNamingConventionScratchAllocator > & matches, TConstArrayView< int32 > name_indices, FStringView prefix, ESearchCase::Type search_case ) const;
+    // Sets the bit of matches of each name of name_indices to whether it ends with the suffix. matches must have one bit per index of name_indices
+    void MatchSuffix( TBitArray< FNamingConventionScratchAllocator > & matches, TConstArrayView< int32 > name_indices, FStringView suffix, ESearchCase::Type search_case ) const;
+
+private:
+    void MatchAffix( TBitArray< FNamingConventionScratchAllocator > & matches, TConstArrayView< int32 > name_indices, FStringView affix, ESearchCase::Type search_case, bool match_suffix ) const;
+
+    TArray< TCHAR > Characters;
+    TArray< int32 > Offsets;
+    TArray< int32 > Lengths;
+};
@@ -0,0 +1,170 @@
+#include "NamingConventionValidationResultStore.h"
+
+#include <Algo/BinarySearch.h>
+#include <Algo/Sort.h>
+
+namespace
+{
+    // Package names are ordered like their strings, ignoring the case like FName does.
+    // FName::Compare is not used as it orders the number suffixes as numbers, which breaks the prefix ranges
+    int32 ComparePackageName( const FName package_name, const FStringView other )
+    {
+        TStringBuilder< 256 > package_name_string;
+        package_name.AppendString( package_name_string );
+        return package_name_string.ToView().Compare( other, ESearchCase::IgnoreCase );
+    }
+
+    bool IsPackageNameLess( const FName package_name, const FName other_package_name )
+    {
+        TStringBuilder< 256 > other_package_name_string;
+        other_package_name.AppendString( other_package_name_string );
+        return ComparePackageName( package_name, other_package_name_string.ToView() ) < 0;
+    }
+
+    bool PackageNameStartsWith( const FName package_name, const FStringView prefix )
+    {
+        TStringBuilder< 256 > package_name_string;
+        package_name.AppendString( package_name_string );
+        return package_name_string.ToView().StartsWith( prefix, ESearchCase::IgnoreCase );
+    }
+
+    bool ShouldAddResult( const FNamingConventionValidationStoredResult & result, const bool only_invalid_results )
+    {
+        return !only_invalid_results || result.Result == ENamingConventionValidationResult::Invalid;
+    }
+}
+
+FNamingConventionValidationResultStore::FNamingConventionValidationResultStore() :
+    ItHasSortedPackageNames( true ),
+    InvalidationTime( FDateTime::MinValue() )
+{
+}
+
+void FNamingConventionValidationResultStore::Reset()
+{
+    ResultsByPackage.Reset();
+    SortedPackageNames.Reset();
+    ItHasSortedPackageNames = true;
+
+    ResultsChangedDelegate.Broadcast();
+}
+
+void FNamingConventionValidationResultStore::Add( const FNamingConventionValidationStoredResult & result )
+{
+    if ( auto * existing_result = ResultsByPackage.Find( result.PackageName ) )
+    {
+        const auto it_has_changed = existing_result->Result != result.Result;
+
+        // The order of the package names does not change
+        *existing_result = result;
+
+        if ( it_has_changed )
+        {
+            ResultsChangedDelegate.Broadcast();
+        }
+        return;
+    }
+
+    ResultsByPackage.Add( result.PackageName, result );
+    SortedPackageNames.Add( result.PackageName );
+    ItHasSortedPackageNames = false;
+
+    ResultsChangedDelegate.Broadcast();
+}
+
+void FNamingConventionValidationResultStore::Remove( const FName package_name )
+{
+    if ( ResultsByPackage.Remove( package_name ) == 0 )
+    {
+        return;
+    }
+
+    ResultsChangedDelegate.Broadcast();
+
+    if ( ItHasSortedPackageNames )
+    {
+        TStringBuilder< 256 > package_name_string;
+        package_name.AppendString( package_name_string );
+
+        const auto index = Algo::LowerBound( SortedPackageNames, package_name_string.ToView(), []( const FName sorted_package_name, const FStringView value ) {
+            return ComparePackageName( sorted_package_name, value ) < 0;
+        } );
+
+        if ( SortedPackageNames.IsValidIndex( index ) && SortedPackageNames[ index ] == package_name )
+        {
+            SortedPackageNames.RemoveAt( index, 1, EAllowShrinking::No );
+            return;
+        }
+    }
+
+    SortedPackageNames.RemoveSingle( package_name );
+}
+
+const FNamingConventionValidationStoredResult * FNamingConventionValidationResultStore::Find( const FName package_name ) const
+{
+    return ResultsByPackage.Find( package_name );
+}
+
+void FNamingConventionValidationResultStore::GetResultsInPath( TArray< FNamingConventionValidationStoredResult > & results, FStringView path, const bool only_invalid_results ) const
+{
+    path.RemoveSuffix( path.EndsWith( TEXT( '/' ) ) ? 1 : 0 );
+
+    if ( const auto * package_result = ResultsByPackage.Find( FName( path, FNAME_Find ) ) )
+    {
+        if ( ShouldAddResult( *package_result, only_invalid_results ) )
+        {
+            results.Add( *package_result );
+        }
+    }
+
+    SortPackageNames();
+
+    TStringBuilder< 256 > folder;
+    folder << path << TEXT( '/' );
+
+    const auto first_index = Algo::LowerBound( SortedPackageNames, folder.ToView(), []( const FName sorted_package_name, const FStringView value ) {
+        return ComparePackageName( sorted_package_name, value ) < 0;
+    } );
+
+    for ( auto index = first_index; index < SortedPackageNames.Num() && PackageNameStartsWith( SortedPackageNames[ index ], folder.ToView() ); ++index )
+    {
+        const auto & package_result = ResultsByPackage.FindChecked( SortedPackageNames[ index ] );
+
+        if ( ShouldAddResult( package_result, only_invalid_results ) )
+        {
+            results.Add( package_result );
+        }
+    }
+}
+
+void FNamingConventionValidationResultStore::Invalidate()
+{
+    InvalidationTime = FDateTime::UtcNow();
+
+    ResultsChangedDelegate.Broadcast();
+}
+
+bool FNamingConventionValidationResultStore::IsStale( const FNamingConventionValidationStoredResult & result ) const
+{
+    // The runs started before the invalidation also produce stale results
+    return result.ValidationTime < InvalidationTime;
+}
+
+int32 FNamingConventionValidationResultStore::Num() const
+{
+    return ResultsByPackage.Num();
+}
+
+FSimpleMulticastDelegate & FNamingConventionValidationResultStore::OnResultsChanged()
+{
+    return ResultsChangedDelegate;
+}
+
+void FNamingConventionValidationResultStore::SortPackageNames() const
+{
+    if ( !ItHasSortedPackageNames )
+    {
+        Algo::Sort( SortedPackageNames, &IsPackageNameLess );
+        ItHasSortedPackageNames = true;
+    }
+}
@@ -0,0 +1,166 @@
+#include "NamingConventionValidationRuleOverlays.h"
+
+#include <Algo/StableSort.h>
+
+namespace
+{
+    // Calls the function with each folder of the path, skipping the empty ones
+    template < typename TFunction >
+    void ForEachFolder( FStringView path, TFunction && function )
+    {
+        while ( !path.IsEmpty() )
+        {
+            auto separator_index = INDEX_NONE;
+            if ( !path.FindChar( TEXT( '/' ), separator_index ) )
+            {
+                separator_index = path.Len();
+            }
+
+            if ( separator_index > 0 && !function( path.Left( separator_index ) ) )
+            {
+                return;
+            }
+
+            path.RightChopInline( separator_index + 1 );
+        }
+    }
+
+    void ApplyRuleOverlay( TArray< FNamingConventionValidationClassDescription > & class_descriptions, const FNamingConventionValidationRuleOverlay & rule_overlay )
+    {
+        if ( rule_overlay.Mode == ENamingConventionRuleOverlayMode::Override )
+        {
+            class_descriptions = rule_overlay.ClassDescriptions;
+            return;
+        }
+
+        class_descriptions.RemoveAll( [ & ]( const FNamingConventionValidationClassDescription & class_description ) {
+            return rule_overlay.ClassDescriptions.ContainsByPredicate( [ & ]( const FNamingConventionValidationClassDescription & overlay_class_description ) {
+                return overlay_class_description.ClassPath == class_description.ClassPath;
+            } );
+        } );
+        class_descriptions.Append( rule_overlay.ClassDescriptions );
+        class_descriptions.Sort();
+    }
+}
+
+FNamingConventionValidationRuleOverlays::FNamingConventionValidationRuleOverlays()
+{
+    Reset();
+}
+
+void FNamingConventionValidationRuleOverlays::Build( const UNamingConventionValidationSettings & settings )
+{
+    Reset();
+
+    // The overlays of the parent folders are applied first, so the ones of the sub-folders start from them
+    TArray< const FNamingConventionValidationRuleOverlay * > rule_overlays;
+    for ( const auto & rule_overlay : settings.RuleOverlays )
+    {
+        if ( !rule_overlay.Folder.Path.IsEmpty() )
+        {
+            rule_overlays.Add( &rule_overlay );
+        }
+    }
+
+    Algo::StableSortBy( rule_overlays, []( const FNamingConventionValidationRuleOverlay * rule_overlay ) {
+        auto depth = 0;
+        ForEachFolder( rule_overlay->Folder.Path, [ & ]( FStringView ) {
+            ++depth;
+            return true;
+        } );
+        return depth;
+    } );
+
+    for ( const auto * rule_overlay : rule_overlays )
+    {
+        auto node_index = 0;
+        auto parent_set_index = Nodes[ 0 ].SetIndex;
+
+        ForEachFolder( rule_overlay->Folder.Path, [ & ]( const FStringView folder ) {
+            const FName folder_name( folder.Len(), folder.GetData() );
+
+            if ( const auto * child_index = Nodes[ node_index ].Children.Find( folder_name ) )
+            {
+                node_index = *child_index;
+            }
+            else
+            {
+                const auto new_node_index = Nodes.AddDefaulted();
+                Nodes[ node_index ].Children.Add( folder_name, new_node_index );
+                node_index = new_node_index;
+            }
+
+            if ( Nodes[ node_index ].SetIndex != INDEX_NONE )
+            {
+                parent_set_index = Nodes[ node_index ].SetIndex;
+            }
+            return true;
+        } );
+
+        // Several overlays of the same folder apply one after the other
+        auto class_descriptions = parent_set_index != INDEX_NONE ? ClassDescriptionSets[ parent_set_index ] : settings.ClassDescriptions;
+        ApplyRuleOverlay( class_descriptions, *rule_overlay );
+
+        if ( Nodes[ node_index ].SetIndex != INDEX_NONE )
+        {
+            ClassDescriptionSets[ Nodes[ node_index ].SetIndex ] = MoveTemp( class_descriptions );
+        }
+        else
+        {
+            Nodes[ node_index ].SetIndex = ClassDescriptionSets.Add( MoveTemp( class_descriptions ) );
+        }
+    }
+}
+
+void FNamingConventionValidationRuleOverlays::Reset()
+{
+    Nodes.Reset();
+    Nodes.AddDefaulted();
+    ClassDescriptionSets.Reset();
+}
+
+bool FNamingConventionValidationRuleOverlays::IsEmpty() const
+{
+    return ClassDescriptionSets.IsEmpty();
+}
+
+int32 FNamingConventionValidationRuleOverlays::FindClassDescriptionSet( const FName package_path ) const
+{
+    if ( IsEmpty() )
+    {
+        return INDEX_NONE;
+    }
+
+    TStringBuilder< 256 > package_path_string;
+    package_path.AppendString( package_path_string );
+    return FindClassDescriptionSet( package_path_string.ToView() );
+}
+
+int32 FNamingConventionValidationRuleOverlays::FindClassDescriptionSet( const FStringView package_path ) const
+{
+    auto node_index = 0;
+    auto set_index = Nodes[ 0 ].SetIndex;
+
+    // The folders of the tree are all in the name table, the other ones are not added to it
+    ForEachFolder( package_path, [ & ]( const FStringView folder ) {
+        const auto * child_index = Nodes[ node_index ].Children.Find( FName( folder.Len(), folder.GetData(), FNAME_Find ) );
+        if ( child_index == nullptr )
+        {
+            return false;
+        }
+
+        node_index = *child_index;
+        if ( Nodes[ node_index ].SetIndex != INDEX_NONE )
+        {
+            set_index = Nodes[ node_index ].SetIndex;
+        }
+        return true;
+    } );
+
+    return set_index;
+}
+
+TConstArrayView< FNamingConventionValidationClassDescription > FNamingConventionValidationRuleOverlays::GetClassDescriptionSet( const int32 set_index ) const
+{
+    return ClassDescriptionSets[ set_index ];
+}
@@ -0,0 +1,587 @@
+#include "NamingConventionValidationRun.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationBaseline.h"
+#include "NamingConventionValidationResultStore.h"
+#include "NamingConventionValidationSettings.h"
+
+#include <Logging/MessageLog.h>
+#include <Misc/UObjectToken.h>
+
+#define LOCTEXT_NAMESPACE "NamingConventionValidationManager"
+
+const FName FNamingConventionValidationRun::NotEvaluatedRuleId( TEXT( "NotEvaluated" ) );
+
+namespace
+{
+    const FName DuplicateAssetNameRuleId( TEXT( "DuplicateAssetName" ) );
+
+    FText GetDuplicateAssetNameMessage( const FName duplicate_package_name )
+    {
+        return FText::Format( LOCTEXT( "DuplicateAssetName", "An asset with the same name already exists in {0}" ), FText::FromName( duplicate_package_name ) );
+    }
+}
+
+FNamingConventionValidationRun::FNamingConventionValidationRun( const UEditorNamingValidatorSubsystem & subsystem, const TConstArrayView< FAssetData > asset_data_list, const bool show_if_no_failures ) :
+    Subsystem( subsystem ),
+    AssetDataList( asset_data_list ),
+    ItShowsIfNoFailures( show_if_no_failures )
+{
+    Initialize();
+}
+
+FNamingConventionValidationRun::FNamingConventionValidationRun( const UEditorNamingValidatorSubsystem & subsystem, TArray< FAssetData > && asset_data_list, const bool show_if_no_failures ) :
+    Subsystem( subsystem ),
+    OwnedAssetDataList( MoveTemp( asset_data_list ) ),
+    ItShowsIfNoFailures( show_if_no_failures )
+{
+    AssetDataList = OwnedAssetDataList;
+    Initialize();
+}
+
+void FNamingConventionValidationRun::SetDuplicateNameIndex( FNamingConventionValidationDuplicateNameIndex * names_index )
+{
+    OwnedNamesIndex.Reset();
+    NamesIndex = names_index;
+}
+
+void FNamingConventionValidationRun::SetBaseline( FNamingConventionValidationBaseline * baseline )
+{
+    Baseline = baseline;
+}
+
+void FNamingConventionValidationRun::SetResultStore( FNamingConventionValidationResultStore * result_store )
+{
+    ResultStore = result_store;
+}
+
+void FNamingConventionValidationRun::SetReportsToMessageLog( const bool it_reports_to_message_log )
+{
+    ItReportsToMessageLog = it_reports_to_message_log;
+}
+
+void FNamingConventionValidationRun::SetWaitsForVerdictCache( const bool it_waits_for_verdict_cache )
+{
+    if ( VerdictCache.IsSet() )
+    {
+        VerdictCache->SetWaitsForVerdicts( it_waits_for_verdict_cache );
+    }
+}
+
+void FNamingConventionValidationRun::AddAssets( const TConstArrayView< FAssetData > asset_data_list )
+{
+    // The view of a run created from a view can not grow
+    check( AssetDataList.GetData() == OwnedAssetDataList.GetData() );
+
+    OwnedAssetDataList.Append( asset_data_list.GetData(), asset_data_list.Num() );
+    AssetDataList = OwnedAssetDataList;
+
+    AddToOwnedNamesIndex( asset_data_list );
+}
+
+void FNamingConventionValidationRun::SetOnVerdicts( TFunction< void( TConstArrayView< FNamingConventionValidationVerdict > verdicts ) > on_verdicts )
+{
+    OnVerdicts = MoveTemp( on_verdicts );
+}
+
+void FNamingConventionValidationRun::SetOnProgress( TFunction< void( int32 processed_count, int32 total_count ) > on_progress )
+{
+    OnProgress = MoveTemp( on_progress );
+}
+
+void FNamingConventionValidationRun::SetOnFinished( TFunction< void( int32 invalid_count, bool was_cancelled ) > on_finished )
+{
+    OnFinished = MoveTemp( on_finished );
+}
+
+bool FNamingConventionValidationRun::ProcessAssets( const double time_limit )
+{
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
+    // The scratch allocations of the run are counted in its own stats, and the ones of a nested run, like the run of each asset of the data validation, are not counted
+    FNamingConventionValidationMemoryStats::FScope memory_stats_scope( ItReportsToMessageLog ? &MemoryStats : nullptr );
+
+    // Each call gets its own message log, which adds the messages to the listing when destroyed. The results are then streamed slice after slice
+    FMessageLog data_validation_log( "NamingConventionValidation" );
+
+    // Small enough for the batch to not exceed the time budget of the background validation
+    static const int32 ValidationBatchSize = 256;
+
+    // The assets of a slice all get the same validation time
+    SliceTime = FDateTime::UtcNow();
+
+    ReportLateDuplicates( data_validation_log );
+
+    while ( !ItIsCancelled && NextAssetIndex < AssetDataList.Num() )
+    {
+        if ( NextAssetIndex >= BatchEndIndex )
+        {
+            BatchStartIndex = NextAssetIndex;
+            BatchEndIndex = FMath::Min( NextAssetIndex + ValidationBatchSize, AssetDataList.Num() );
+
+            const auto batch_asset_data_list = AssetDataList.Slice( BatchStartIndex, BatchEndIndex - BatchStartIndex );
+
+            // The cache requests run while the batch is evaluated
+            if ( VerdictCache.IsSet() )
+            {
+                VerdictCache->RequestBatch( batch_asset_data_list );
+            }
+
+            Subsystem.EvaluateAssetBatch( BatchVerdicts, batch_asset_data_list, &ValidationBudget );
+
+            // The memory is only reported by the runs which report to the message log
+            if ( ItReportsToMessageLog )
+            {
+                MemoryStats.Sample();
+            }
+        }
+
+        const auto batch_asset_index = NextAssetIndex - BatchStartIndex;
+        const auto asset_verdicts = BatchVerdicts.GetAssetVerdicts( batch_asset_index );
+        ValidateAsset( data_validation_log, AssetDataList[ NextAssetIndex ], batch_asset_index, &asset_verdicts );
+
+        ++NextAssetIndex;
+
+        if ( FPlatformTime::Seconds() >= time_limit )
+        {
+            break;
+        }
+    }
+
+    if ( ItReportsToMessageLog )
+    {
+        MemoryStats.Sample();
+    }
+
+    if ( OnVerdicts && !SliceVerdicts.IsEmpty() )
+    {
+        OnVerdicts( SliceVerdicts );
+    }
+    SliceVerdicts.Reset();
+
+    if ( OnProgress )
+    {
+        OnProgress( NextAssetIndex, AssetDataList.Num() );
+    }
+
+    return ItIsCancelled || NextAssetIndex >= AssetDataList.Num();
+}
+
+void FNamingConventionValidationRun::Cancel()
+{
+    ItIsCancelled = true;
+}
+
+int32 FNamingConventionValidationRun::Finish()
+{
+    LLM_SCOPE_BYTAG( NamingConventionValidation );
+
+    FMessageLog data_validation_log( "NamingConventionValidation" );
+
+    const auto has_failed = NumInvalidFiles > 0;
+
+    // The excluded, known and unknown assets are only reported at the end, grouped, so large validations do not flood the log
+    MessageGroups.Flush( data_validation_log );
+
+    // The runs which do not report to the message log, like the one of each asset of the data validation, would flood the output log with their summaries
+    TArray< FString > memory_lines;
+    if ( ItReportsToMessageLog )
+    {
+        if ( VerdictCache.IsSet() )
+        {
+            UE_LOG( LogNamingConventionValidation, Display, TEXT( "Naming convention verdicts from the Derived Data Cache : %i hits, %i misses" ), VerdictCache->GetHitCount(), VerdictCache->GetMissCount() );
+        }
+
+        MemoryStats.GetReportLines( memory_lines, NextAssetIndex );
+
+        for ( const auto & memory_line : memory_lines )
+        {
+            UE_LOG( LogNamingConventionValidation, Display, TEXT( "%s" ), *memory_line );
+        }
+    }
+
+    if ( ValidationBudget.HasDisabledValidators() )
+    {
+        TArray< FString > budget_lines;
+        ValidationBudget.GetReportLines( budget_lines );
+
+        for ( const auto & budget_line : budget_lines )
+        {
+            UE_LOG( LogNamingConventionValidation, Warning, TEXT( "%s" ), *budget_line );
+
+            if ( ItReportsToMessageLog )
+            {
+                data_validation_log.Warning( FText::FromString( budget_line ) );
+            }
+        }
+    }
+
+    if ( OnFinished )
+    {
+        OnFinished( NumInvalidFiles, ItIsCancelled );
+    }
+
+    if ( ItReportsToMessageLog && ( has_failed || ItShowsIfNoFailures ) )
+    {
+        FFormatNamedArguments arguments;
+        arguments.Add( TEXT( "Result" ), ItIsCancelled ? LOCTEXT( "Cancelled", "CANCELLED" ) : has_failed ? LOCTEXT( "Failed", "FAILED" ) : LOCTEXT( "Succeeded", "SUCCEEDED" ) );
+        arguments.Add( TEXT( "NumChecked" ), NumFilesChecked );
+        arguments.Add( TEXT( "NumValid" ), NumValidFiles );
+        arguments.Add( TEXT( "NumInvalid" ), NumInvalidFiles );
+        arguments.Add( TEXT( "NumSkipped" ), NumFilesSkipped );
+        arguments.Add( TEXT( "NumUnableToValidate" ), NumFilesUnableToValidate );
+
+        auto validation_log = has_failed ? data_validation_log.Error() : data_validation_log.Info();
+        validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "SuccessOrFailure", "NamingConvention Validation {Result}." ), arguments ) ) );
+        validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "ResultsSummary", "Files Checked: {NumChecked}, Passed: {NumValid}, Failed: {NumInvalid}, Skipped: {NumSkipped}, Unable to validate: {NumUnableToValidate}" ), arguments ) ) );
+
+        if ( Baseline != nullptr )
+        {
+            arguments.Add( TEXT( "NumKnown" ), NumKnownViolations );
+            validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "BaselineSummary", "Known violations: {NumKnown}" ), arguments ) ) );
+        }
+
+        if ( NumFilesNotEvaluated > 0 )
+        {
+            arguments.Add( TEXT( "NumNotEvaluated" ), NumFilesNotEvaluated );
+            validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "NotEvaluatedSummary", "Not evaluated by the validators disabled by their time budget: {NumNotEvaluated}" ), arguments ) ) );
+        }
+
+        if ( VerdictCache.IsSet() )
+        {
+            arguments.Add( TEXT( "NumCacheHits" ), VerdictCache->GetHitCount() );
+            arguments.Add( TEXT( "NumCacheMisses" ), VerdictCache->GetMissCount() );
+            validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "VerdictCacheSummary", "Derived Data Cache hits: {NumCacheHits}, misses: {NumCacheMisses}" ), arguments ) ) );
+        }
+
+        for ( const auto & memory_line : memory_lines )
+        {
+            validation_log->AddToken( FTextToken::Create( FText::FromString( memory_line ) ) );
+        }
+
+        data_validation_log.Open( EMessageSeverity::Info, true );
+    }
+
+    return NumInvalidFiles;
+}
+
+bool FNamingConventionValidationRun::IsCancelled() const
+{
+    return ItIsCancelled;
+}
+
+bool FNamingConventionValidationRun::ShowsIfNoFailures() const
+{
+    return ItShowsIfNoFailures;
+}
+
+int32 FNamingConventionValidationRun::Num() const
+{
+    return AssetDataList.Num();
+}
+
+int32 FNamingConventionValidationRun::GetProcessedCount() const
+{
+    return NextAssetIndex;
+}
+
+int32 FNamingConventionValidationRun::GetInvalidCount() const
+{
+    return NumInvalidFiles;
+}
+
+void FNamingConventionValidationRun::Initialize()
+{
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+    // Only the assets of the run are compared together
+    if ( settings->bDetectDuplicateAssetNames )
+    {
+        OwnedNamesIndex.Emplace( settings->bDuplicateAssetNamesAreScopedByClass );
+        OwnedNamesIndex->Reserve( AssetDataList.Num() );
+    }
+
+    NamesIndex = OwnedNamesIndex.GetPtrOrNull();
+    AddToOwnedNamesIndex( AssetDataList );
+    Baseline = nullptr;
+    ResultStore = nullptr;
+    NextAssetIndex = 0;
+    BatchStartIndex = 0;
+    BatchEndIndex = 0;
+    ItIsCancelled = false;
+    ItReportsToMessageLog = true;
+
+    VerdictCache.Reset();
+    if ( settings->bShareVerdictsThroughDerivedDataCache )
+    {
+        VerdictCache.Emplace( Subsystem.GetVerdictFingerprint() );
+    }
+
+    NumFilesChecked = 0;
+    NumValidFiles = 0;
+    NumInvalidFiles = 0;
+    NumFilesSkipped = 0;
+    NumFilesUnableToValidate = 0;
+    NumKnownViolations = 0;
+    NumFilesNotEvaluated = 0;
+
+    ValidationBudget.Reset();
+    MemoryStats.Reset();
+}
+
+void FNamingConventionValidationRun::AddToOwnedNamesIndex( const TConstArrayView< FAssetData > asset_data_list )
+{
+    if ( !OwnedNamesIndex.IsSet() )
+    {
+        return;
+    }
+
+    // The index is filled before the validation, so all the assets sharing a name are reported, and not only the ones validated after the first one.
+    // Like the index of the project, it skips the folders and the classes the registry query of GetAssetsToValidate excludes
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+    for ( const auto & asset_data : asset_data_list )
+    {
+        TStringBuilder< 256 > package_name;
+        asset_data.PackageName.AppendString( package_name );
+
+        if ( asset_data.IsRedirector() || settings->IsPathExcludedFromValidation( package_name.ToView() ) || Subsystem.IsAssetClassExcludedFromQuery( asset_data ) )
+        {
+            continue;
+        }
+
+        const auto duplicate_package_name = OwnedNamesIndex->Add( asset_data );
+        if ( duplicate_package_name.IsNone() )
+        {
+            continue;
+        }
+
+        // When the assets are added while they are discovered, like by ValidateAssetsWhileScanning, the other asset can already be validated.
+        // The index usually has no duplicates, so the processed assets are only searched for those
+        for ( auto asset_index = 0; asset_index < CountedResults.Num(); ++asset_index )
+        {
+            if ( CountedResults[ asset_index ] != ECountedResult::Final && AssetDataList[ asset_index ].PackageName == duplicate_package_name )
+            {
+                LateDuplicates.Add( { asset_index, CountedResults[ asset_index ], asset_data.PackageName } );
+                CountedResults[ asset_index ] = ECountedResult::Final;
+                break;
+            }
+        }
+    }
+}
+
+void FNamingConventionValidationRun::ReportLateDuplicates( FMessageLog & data_validation_log )
+{
+    for ( const auto & late_duplicate : LateDuplicates )
+    {
+        // The messages of the previous result stay in the message groups
+        switch ( late_duplicate.CountedResult )
+        {
+            case ECountedResult::Valid:
+            {
+                --NumValidFiles;
+                --NumFilesChecked;
+            }
+            break;
+            case ECountedResult::Unknown:
+            {
+                --NumFilesUnableToValidate;
+                --NumFilesChecked;
+            }
+            break;
+            case ECountedResult::NotEvaluated:
+            {
+                --NumFilesNotEvaluated;
+            }
+            break;
+            case ECountedResult::Final:
+            {
+                checkNoEntry();
+            }
+            break;
+        }
+
+        ReportResult( data_validation_log, AssetDataList[ late_duplicate.AssetIndex ], ENamingConventionValidationResult::Invalid, DuplicateAssetNameRuleId, GetDuplicateAssetNameMessage( late_duplicate.DuplicatePackageName ) );
+    }
+
+    LateDuplicates.Reset();
+}
+
+void FNamingConventionValidationRun::ValidateAsset( FMessageLog & data_validation_log, const FAssetData & asset_data, const int32 batch_asset_index, const FNamingConventionAssetBatchVerdicts * batch_verdicts )
+{
+    FText error_message;
+    FName rule_id;
+    auto result = ENamingConventionValidationResult::Unknown;
+
+    ValidationBudget.BeginAsset();
+
+    // The duplicate names depend on the other assets, so they are checked after, and never cached
+    if ( !VerdictCache.IsSet() || !VerdictCache->FindVerdict( batch_asset_index, result, rule_id, error_message ) )
+    {
+        result = Subsystem.IsAssetNamedCorrectly( error_message, rule_id, asset_data, true, batch_verdicts, &ValidationBudget );
+
+        // The verdict is incomplete without the validators the budget disabled
+        if ( VerdictCache.IsSet() && ValidationBudget.GetSkippedValidators().IsEmpty() )
+        {
+            VerdictCache->AddVerdict( batch_asset_index, result, rule_id, error_message );
+        }
+    }
+
+    if ( NamesIndex != nullptr && result != ENamingConventionValidationResult::Excluded )
+    {
+        const auto duplicate_package_name = NamesIndex->Add( asset_data );
+
+        if ( !duplicate_package_name.IsNone() && result != ENamingConventionValidationResult::Invalid )
+        {
+            error_message = GetDuplicateAssetNameMessage( duplicate_package_name );
+            rule_id = DuplicateAssetNameRuleId;
+            result = ENamingConventionValidationResult::Invalid;
+        }
+    }
+
+    // Without the validators the budget disabled, a pass or an unknown verdict could be a failure, so they are not reported. A failure is reported like any other one
+    const auto it_is_evaluated = ValidationBudget.GetSkippedValidators().IsEmpty() || ( result != ENamingConventionValidationResult::Valid && result != ENamingConventionValidationResult::Unknown );
+
+    if ( !it_is_evaluated )
+    {
+        if ( ItReportsToMessageLog )
+        {
+            for ( const auto * skipped_validator : ValidationBudget.GetSkippedValidators() )
+            {
+                MessageGroups.Add( FNamingConventionValidationMessageGroups::EKind::NotEvaluated, FName( *skipped_validator->GetClass()->GetPathName() ), asset_data, FText::GetEmpty() );
+            }
+        }
+
+        ++NumFilesNotEvaluated;
+
+        // The previous result of the package, if any, stays in the result store
+        if ( OnVerdicts )
+        {
+            auto & verdict = SliceVerdicts.AddDefaulted_GetRef();
+            verdict.PackageName = asset_data.PackageName;
+            verdict.AssetName = asset_data.AssetName;
+            verdict.Result = ENamingConventionValidationResult::Unknown;
+            verdict.RuleId = NotEvaluatedRuleId;
+            verdict.Message = LOCTEXT( "NotEvaluatedVerdict", "Not evaluated, a validator was disabled for exceeding its time budget." );
+        }
+
+        if ( OwnedNamesIndex.IsSet() )
+        {
+            CountedResults.Add( ECountedResult::NotEvaluated );
+        }
+
+        return;
+    }
+
+    ReportResult( data_validation_log, asset_data, result, rule_id, error_message );
+
+    if ( OwnedNamesIndex.IsSet() )
+    {
+        switch ( result )
+        {
+            case ENamingConventionValidationResult::Valid:
+            {
+                CountedResults.Add( ECountedResult::Valid );
+            }
+            break;
+            case ENamingConventionValidationResult::Unknown:
+            {
+                CountedResults.Add( ECountedResult::Unknown );
+            }
+            break;
+            default:
+            {
+                CountedResults.Add( ECountedResult::Final );
+            }
+            break;
+        }
+    }
+}
+
+void FNamingConventionValidationRun::ReportResult( FMessageLog & data_validation_log, const FAssetData & asset_data, const ENamingConventionValidationResult result, const FName rule_id, const FText & error_message )
+{
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+    if ( ResultStore != nullptr )
+    {
+        FNamingConventionValidationStoredResult stored_result;
+        stored_result.PackageName = asset_data.PackageName;
+        stored_result.Result = result;
+        stored_result.RuleId = rule_id;
+        stored_result.ValidationTime = SliceTime;
+        ResultStore->Add( stored_result );
+    }
+
+    if ( OnVerdicts )
+    {
+        auto & verdict = SliceVerdicts.AddDefaulted_GetRef();
+        verdict.PackageName = asset_data.PackageName;
+        verdict.AssetName = asset_data.AssetName;
+        verdict.Result = result;
+        verdict.RuleId = rule_id;
+        verdict.Message = error_message;
+    }
+
+    switch ( result )
+    {
+        case ENamingConventionValidationResult::Excluded:
+        {
+            if ( ItReportsToMessageLog )
+            {
+                MessageGroups.Add( FNamingConventionValidationMessageGroups::EKind::Excluded, rule_id, asset_data, error_message );
+            }
+
+            ++NumFilesSkipped;
+        }
+        break;
+        case ENamingConventionValidationResult::Valid:
+        {
+            ++NumValidFiles;
+            ++NumFilesChecked;
+        }
+        break;
+        case ENamingConventionValidationResult::Invalid:
+        {
+            // Known violations are reported, but do not make the validation fail
+            if ( Baseline != nullptr && Baseline->RecordViolation( asset_data.PackageName, rule_id ) )
+            {
+                if ( ItReportsToMessageLog )
+                {
+                    MessageGroups.Add( FNamingConventionValidationMessageGroups::EKind::KnownViolation, rule_id, asset_data, error_message );
+                }
+
+                ++NumKnownViolations;
+                ++NumFilesChecked;
+                break;
+            }
+
+            if ( ItReportsToMessageLog )
+            {
+                data_validation_log.Error()
+                    ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
+                    ->AddToken( FTextToken::Create( LOCTEXT( "InvalidNamingConventionResult", "does not match naming convention." ) ) )
+                    ->AddToken( FTextToken::Create( error_message ) );
+            }
+
+            ++NumInvalidFiles;
+            ++NumFilesChecked;
+        }
+        break;
+        case ENamingConventionValidationResult::Unknown:
+        {
+            if ( ItReportsToMessageLog && ItShowsIfNoFailures && settings->bLogWarningWhenNoClassDescriptionForAsset )
+            {
+                FFormatNamedArguments arguments;
+                arguments.Add( TEXT( "ClassName" ), FText::FromString( asset_data.AssetClassPath.ToString() ) );
+
+                // Grouped by class
+                MessageGroups.Add( FNamingConventionValidationMessageGroups::EKind::Unknown, FName( asset_data.AssetClassPath.ToString() ), asset_data, FText::Format( LOCTEXT( "UnknownClass", " Class = {ClassName}" ), arguments ) );
+            }
+            ++NumFilesChecked;
+            ++NumFilesUnableToValidate;
+        }
+        break;
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationBudget.h"
+#include "NamingConventionValidationDuplicateNameIndex.h"
+#include "NamingConventionValidationMemory.h"
+#include "NamingConventionValidationMessageGroups.h"
+#include "NamingConventionValidationTypes.h"
+#include "NamingConventionValidationVerdictCache.h"
+
+#include <AssetRegistry/AssetData.h>
+#include <CoreMinimal.h>
+
+class FMessageLog;
+class FNamingConventionValidationBaseline;
+class FNamingConventionValidationResultStore;
+
+// Validates a list of assets and reports the results to the message log.
+// The assets can be processed all at once or in several time slices, and the run can be cancelled between two slices
+class FNamingConventionValidationRun
+{
+public:
+    UE_NONCOPYABLE( FNamingConventionValidationRun );
+
+    // The asset list must outlive the run
+    FNamingConventionValidationRun( const UEditorNamingValidatorSubsystem & subsystem, TConstArrayView< FAssetData > asset_data_list, bool show_if_no_failures );
+    FNamingConventionValidationRun( const UEditorNamingValidatorSubsystem & subsystem, TArray< FAssetData > && asset_data_list, bool show_if_no_failures );
+
+    // By default, only the assets of the run are compared together to detect the duplicate names
+    void SetDuplicateNameIndex( FNamingConventionValidationDuplicateNameIndex * names_index );
+    void SetBaseline( FNamingConventionValidationBaseline * baseline );
+    // The result of each validated asset replaces the previous result of its package in the store
+    void SetResultStore( FNamingConventionValidationResultStore * result_store );
+    void SetReportsToMessageLog( bool it_reports_to_message_log );
+    // By default, the run waits for the verdicts of the Derived Data Cache. Else, the assets whose verdict is not ready are validated locally
+    void SetWaitsForVerdictCache( bool it_waits_for_verdict_cache );
+    // Appends assets to a run which owns its asset list, while it is processed. They are validated after the assets already in the list
+    void AddAssets( TConstArrayView< FAssetData > asset_data_list );
+
+    // Called at the end of each slice with the verdicts of the assets validated during the slice.
+    // The assets not evaluated by the validators disabled by their time budget have an Unknown result with the rule NotEvaluatedRuleId
+    void SetOnVerdicts( TFunction< void( TConstArrayView< FNamingConventionValidationVerdict > verdicts ) > on_verdicts );
+    // Called at the end of each slice
+    void SetOnProgress( TFunction< void( int32 processed_count, int32 total_count ) > on_progress );
+    void SetOnFinished( TFunction< void( int32 invalid_count, bool was_cancelled ) > on_finished );
+
+    // Validates the assets until all of them are processed, or until the platform time reaches time_limit. Returns true when all the assets are processed
+    bool ProcessAssets( double time_limit = TNumericLimits< double >::Max() );
+    void Cancel();
+    // Writes the summary to the message log, and returns the number of invalid assets
+    int32 Finish();
+
+    bool IsCancelled() const;
+    bool ShowsIfNoFailures() const;
+    int32 Num() const;
+    int32 GetProcessedCount() const;
+    int32 GetInvalidCount() const;
+
+    static const FName NotEvaluatedRuleId;
+
+private:
+    void Initialize();
+    void AddToOwnedNamesIndex( TConstArrayView< FAssetData > asset_data_list );
+    void ValidateAsset( FMessageLog & data_validation_log, const FAssetData & asset_data, int32 batch_asset_index, const FNamingConventionAssetBatchVerdicts * batch_verdicts );
+    // Stores, reports and counts the result of a validated asset
+    void ReportResult( FMessageLog & data_validation_log, const FAssetData & asset_data, ENamingConventionValidationResult result, FName rule_id, const FText & error_message );
+    // Reports the processed assets which share their name with assets added after their validation, in place of the result they were counted with
+    void ReportLateDuplicates( FMessageLog & data_validation_log );
+
+    // How each processed asset was counted, while the run fills its own names index. A processed asset can get a duplicate when assets are added to the run
+    enum class ECountedResult : uint8
+    {
+        Valid,
+        Unknown,
+        NotEvaluated,
+        // Invalid, excluded, or already reported as a duplicate
+        Final
+    };
+
+    struct FLateDuplicate
+    {
+        int32 AssetIndex;
+        ECountedResult CountedResult;
+        FName DuplicatePackageName;
+    };
+
+    TFunction< void( TConstArrayView< FNamingConventionValidationVerdict > verdicts ) > OnVerdicts;
+    TFunction< void( int32 processed_count, int32 total_count ) > OnProgress;
+    TFunction< void( int32 invalid_count, bool was_cancelled ) > OnFinished;
+    TArray< FNamingConventionValidationVerdict > SliceVerdicts;
+
+    const UEditorNamingValidatorSubsystem & Subsystem;
+    TArray< FAssetData > OwnedAssetDataList;
+    TConstArrayView< FAssetData > AssetDataList;
+    TOptional< FNamingConventionValidationDuplicateNameIndex > OwnedNamesIndex;
+    TArray< ECountedResult > CountedResults;
+    // Reported at the start of the next slice
+    TArray< FLateDuplicate > LateDuplicates;
+    FNamingConventionValidationDuplicateNameIndex * NamesIndex;
+    FNamingConventionValidationBaseline * Baseline;
+    FNamingConventionValidationResultStore * ResultStore;
+    FDateTime SliceTime;
+    FNamingConventionValidationMessageGroups MessageGroups;
+    int32 NextAssetIndex;
+
+    // The thread safe validators are evaluated in parallel for a batch of assets, before the batch is validated on the game thread
+    FNamingConventionBatchVerdicts BatchVerdicts;
+    // Disables the validators which exceed their time budget until the end of the run
+    FNamingConventionValidationBudget ValidationBudget;
+    // Sampled after each batch, so the summary reports the peak memory of the run
+    FNamingConventionValidationMemoryStats MemoryStats;
+    // Set when the verdicts are shared through the Derived Data Cache. The verdicts of a batch are requested when the batch starts
+    TOptional< FNamingConventionValidationVerdictCache > VerdictCache;
+    int32 BatchStartIndex;
+    int32 BatchEndIndex;
+    bool ItShowsIfNoFailures;
+    bool ItReportsToMessageLog;
+    bool ItIsCancelled;
+
+    int32 NumFilesChecked;
+    int32 NumValidFiles;
+    int32 NumInvalidFiles;
+    int32 NumFilesSkipped;
+    int32 NumFilesUnableToValidate;
+    int32 NumKnownViolations;
+    int32 NumFilesNotEvaluated;
+};
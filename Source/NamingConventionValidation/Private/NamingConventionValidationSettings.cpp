@@ -1,6 +1,11 @@
 #include "NamingConventionValidation/Public/NamingConventionValidationSettings.h"
 #include "NamingConventionValidationLog.h"
 
+#include <Engine/BlueprintCore.h>
+#include <Misc/PackagePath.h>
+#include <String/Find.h>
+#include <UObject/ObjectRedirector.h>
+
 FString FNamingConventionValidationClassDescription::ToString() const
 {
     return FString::Printf( TEXT( "ClassPath : %s - Prefix : %s - Suffix : %s - Priority : %i" ),
@@ -17,12 +22,42 @@ UNamingConventionValidationSettings::UNamingConventionValidationSettings()
     bAllowValidationInDevelopersFolder = false;
     bAllowValidationOnlyInGameFolder = true;
     bDoesValidateOnSave = true;
+    bValidateOnImport = false;
+    bApplyAffixesOnImport = false;
+    bValidateFoldersInBackground = true;
+    BackgroundValidationTimeBudgetMs = 8.0f;
+    ValidatorCallTimeBudgetMs = 250.0f;
+    ValidatorRunTimeBudgetMs = 60000.0f;
+    bValidateWithDataValidation = false;
+    bShareVerdictsThroughDerivedDataCache = false;
+    bValidateWhileCooking = false;
+    bFailCookOnNewViolations = false;
+    ExternalPackagesValidationMode = ENamingConventionExternalPackagesValidationMode::Skip;
     BlueprintsPrefix = "BP_";
+    bDetectDuplicateAssetNames = false;
+    bDuplicateAssetNamesAreScopedByClass = false;
+}
+
+bool UNamingConventionValidationSettings::IsExternalActorPath( const FStringView path )
+{
+    static const auto ExternalActorsFolder = FString::Printf( TEXT( "/%s/" ), FPackagePath::GetExternalActorsFolderName() );
+    return UE::String::FindFirst( path, ExternalActorsFolder, ESearchCase::IgnoreCase ) != INDEX_NONE;
 }
 
-bool UNamingConventionValidationSettings::IsPathExcludedFromValidation( const FString & path ) const
+bool UNamingConventionValidationSettings::IsExternalObjectPath( const FStringView path )
 {
-    if ( !path.StartsWith( "/Game/" ) && bAllowValidationOnlyInGameFolder )
+    static const auto ExternalObjectsFolder = FString::Printf( TEXT( "/%s/" ), FPackagePath::GetExternalObjectsFolderName() );
+    return UE::String::FindFirst( path, ExternalObjectsFolder, ESearchCase::IgnoreCase ) != INDEX_NONE;
+}
+
+bool UNamingConventionValidationSettings::IsPathExcludedFromValidation( const FStringView path ) const
+{
+    if ( IsExternalObjectPath( path ) || ( ExternalPackagesValidationMode == ENamingConventionExternalPackagesValidationMode::Skip && IsExternalActorPath( path ) ) )
+    {
+        return true;
+    }
+
+    if ( !path.StartsWith( TEXT( "/Game/" ) ) && bAllowValidationOnlyInGameFolder )
     {
         auto can_process_folder = NonGameFoldersDirectoriesToProcess.FindByPredicate( [ &path ]( const auto & directory ) {
             return path.StartsWith( directory.Path );
@@ -31,7 +66,7 @@ bool UNamingConventionValidationSettings::IsPathExcludedFromValidation( const FS
         if ( !can_process_folder )
         {
             can_process_folder = NonGameFoldersDirectoriesToProcessContainingToken.FindByPredicate( [ &path ]( const auto & token ) {
-                return path.Contains( token );
+                return UE::String::FindFirst( path, token, ESearchCase::IgnoreCase ) != INDEX_NONE;
             } ) != nullptr;
         }
 
@@ -41,7 +76,7 @@ bool UNamingConventionValidationSettings::IsPathExcludedFromValidation( const FS
         }
     }
 
-    if ( path.StartsWith( "/Game/Developers/" ) && !bAllowValidationInDevelopersFolder )
+    if ( path.StartsWith( TEXT( "/Game/Developers/" ) ) && !bAllowValidationInDevelopersFolder )
     {
         return true;
     }
@@ -57,16 +92,134 @@ bool UNamingConventionValidationSettings::IsPathExcludedFromValidation( const FS
     return false;
 }
 
+bool UNamingConventionValidationSettings::IsFolderExcludedFromValidation( const FString & folder_path ) const
+{
+    const auto folder = folder_path.EndsWith( TEXT( "/" ) ) ? folder_path : folder_path + TEXT( "/" );
+
+    if ( IsExternalObjectPath( folder ) || ( ExternalPackagesValidationMode == ENamingConventionExternalPackagesValidationMode::Skip && IsExternalActorPath( folder ) ) )
+    {
+        return true;
+    }
+
+    if ( !folder.StartsWith( "/Game/" ) && bAllowValidationOnlyInGameFolder )
+    {
+        // Tokens can also be found in the asset names, so we can not know in advance that all the assets of the folder will be skipped
+        const auto can_process_folder = !NonGameFoldersDirectoriesToProcessContainingToken.IsEmpty() || NonGameFoldersDirectoriesToProcess.ContainsByPredicate( [ &folder ]( const auto & directory ) {
+            return folder.StartsWith( directory.Path ) || directory.Path.StartsWith( folder );
+        } );
+
+        if ( !can_process_folder )
+        {
+            return true;
+        }
+    }
+
+    // The remaining checks only test prefixes, so they give the same result for the folder as for all the packages it contains
+    if ( folder.StartsWith( "/Game/Developers/" ) && !bAllowValidationInDevelopersFolder )
+    {
+        return true;
+    }
+
+    return ExcludedDirectories.ContainsByPredicate( [ &folder ]( const auto & excluded_path ) {
+        return folder.StartsWith( excluded_path.Path );
+    } );
+}
+
+void UNamingConventionValidationSettings::GetAssetRegistryExcludedClassPaths( TSet< FTopLevelAssetPath > & class_paths ) const
+{
+    // Redirectors hold the name of the asset they point to, there is nothing to validate
+    class_paths.Add( UObjectRedirector::StaticClass()->GetClassPathName() );
+
+    for ( const auto * excluded_class : ExcludedClasses )
+    {
+        // The registry filters on the asset class, but IsClassExcluded tests the native parent class of blueprints.
+        // Excluding a class related to UBlueprintCore or UClass in the query would then discard blueprints which must be validated
+        const auto is_related_to_blueprints = excluded_class->IsChildOf( UBlueprintCore::StaticClass() )
+                                              || UBlueprintCore::StaticClass()->IsChildOf( excluded_class )
+                                              || excluded_class->IsChildOf( UClass::StaticClass() )
+                                              || UClass::StaticClass()->IsChildOf( excluded_class );
+
+        if ( !is_related_to_blueprints )
+        {
+            class_paths.Add( excluded_class->GetClassPathName() );
+        }
+    }
+}
+
 void UNamingConventionValidationSettings::PostProcessSettings()
 {
-    for ( auto & class_description : ClassDescriptions )
+    RebuildClassDescriptions();
+    RebuildRuleOverlays();
+    RebuildExcludedClasses();
+    RebuildExcludedDirectories();
+}
+
+#if WITH_EDITOR
+void UNamingConventionValidationSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    const auto property_name = PropertyChangedEvent.GetMemberPropertyName();
+
+    // Only what depends on the edited property is rebuilt. The other properties are read as they are during the validation
+    if ( property_name == GET_MEMBER_NAME_CHECKED( UNamingConventionValidationSettings, ClassDescriptions ) )
+    {
+        RebuildClassDescriptions();
+    }
+    else if ( property_name == GET_MEMBER_NAME_CHECKED( UNamingConventionValidationSettings, RuleOverlays ) )
+    {
+        RebuildRuleOverlays();
+    }
+    else if ( property_name == GET_MEMBER_NAME_CHECKED( UNamingConventionValidationSettings, ExcludedClassPaths ) )
+    {
+        RebuildExcludedClasses();
+    }
+    else if ( property_name == GET_MEMBER_NAME_CHECKED( UNamingConventionValidationSettings, ExcludedDirectories ) )
+    {
+        RebuildExcludedDirectories();
+    }
+    else if ( property_name.IsNone() )
     {
-        class_description.Class = class_description.ClassPath.LoadSynchronous();
+        PostProcessSettings();
+    }
+
+    // Broadcasts OnSettingChanged, once the settings are up to date
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UNamingConventionValidationSettings::RebuildClassDescriptions( TArray< FNamingConventionValidationClassDescription > & class_descriptions, const FString & rule_id_suffix )
+{
+    for ( auto & class_description : class_descriptions )
+    {
+        // The classes which are still valid are kept, only the new or edited class paths get loaded
+        if ( class_description.Class == nullptr || class_description.Class->GetClassPathName() != class_description.ClassPath.ToSoftObjectPath().GetAssetPath() )
+        {
+            class_description.Class = class_description.ClassPath.LoadSynchronous();
+            UE_CLOG( class_description.Class == nullptr, LogNamingConventionValidation, Warning, TEXT( "Impossible to get a valid UClass for the classpath %s" ), *class_description.ClassPath.ToString() );
+        }
 
-        UE_CLOG( class_description.Class == nullptr, LogNamingConventionValidation, Warning, TEXT( "Impossible to get a valid UClass for the classpath %s" ), *class_description.ClassPath.ToString() );
+        class_description.RuleId = FName( *FString::Printf( TEXT( "ClassDescription.%s%s" ), *class_description.ClassPath.ToString(), *rule_id_suffix ) );
     }
 
-    ClassDescriptions.Sort();
+    class_descriptions.Sort();
+}
+
+void UNamingConventionValidationSettings::RebuildClassDescriptions()
+{
+    RebuildClassDescriptions( ClassDescriptions, FString() );
+}
+
+void UNamingConventionValidationSettings::RebuildRuleOverlays()
+{
+    // The rules of the overlays are identified by their folder too, so the baselines tell them apart from the rules of the project
+    for ( auto & rule_overlay : RuleOverlays )
+    {
+        RebuildClassDescriptions( rule_overlay.ClassDescriptions, TEXT( "@" ) + rule_overlay.Folder.Path );
+    }
+}
+
+void UNamingConventionValidationSettings::RebuildExcludedClasses()
+{
+    ExcludedClasses.Reset();
 
     for ( auto & class_path : ExcludedClassPaths )
     {
@@ -75,10 +228,13 @@ void UNamingConventionValidationSettings::PostProcessSettings()
 
         if ( excluded_class != nullptr )
         {
-            ExcludedClasses.Add( excluded_class );
+            ExcludedClasses.AddUnique( excluded_class );
         }
     }
+}
 
+void UNamingConventionValidationSettings::RebuildExcludedDirectories()
+{
     static const FDirectoryPath
         EngineDirectoryPath( { TEXT( "/Engine/" ) } );
 
@@ -90,11 +246,3 @@ void UNamingConventionValidationSettings::PostProcessSettings()
         ExcludedDirectories.Add( EngineDirectoryPath );
     }
 }
-
-#if WITH_EDITOR
-void UNamingConventionValidationSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
-{
-    Super::PostEditChangeProperty(PropertyChangedEvent);
-    PostProcessSettings();
-}
-#endif
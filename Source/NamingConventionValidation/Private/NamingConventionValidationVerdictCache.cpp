@@ -0,0 +1,235 @@
+#include "NamingConventionValidationVerdictCache.h"
+
+#include <AssetRegistry/AssetRegistryModule.h>
+#include <DerivedDataCacheInterface.h>
+#include <IO/IoHash.h>
+#include <Misc/PackageName.h>
+#include <Serialization/MemoryReader.h>
+#include <Serialization/MemoryWriter.h>
+#include <UObject/Package.h>
+
+namespace
+{
+    // Change it when the content of the verdicts or the way they are computed changes, to not read the verdicts of older versions
+    const TCHAR * VerdictCacheVersion = TEXT( "6C1D83A2E1F04B5C9B3E0D1F7A2C4E91" );
+    const uint8 VerdictFormatVersion = 1;
+
+    // The requests which were not complete when their verdict was needed. Their results must still be retrieved to be released,
+    // which is done once they complete, by any cache, since a run can finish before its late requests
+    TArray< uint32 > & GetLateHandles()
+    {
+        static TArray< uint32 > LateHandles;
+        return LateHandles;
+    }
+
+    void ReleaseCompletedLateHandles()
+    {
+        auto & derived_data_cache = GetDerivedDataCacheRef();
+
+        GetLateHandles().RemoveAllSwap( [ & ]( const uint32 handle ) {
+            if ( !derived_data_cache.PollAsynchronousCompletion( handle ) )
+            {
+                return false;
+            }
+
+            TArray< uint8 > data;
+            derived_data_cache.GetAsynchronousResults( handle, data );
+            return true;
+        } );
+    }
+}
+
+FNamingConventionValidationVerdictCache::FNamingConventionValidationVerdictCache( FString fingerprint ) :
+    Fingerprint( MoveTemp( fingerprint ) ),
+    ItWaitsForVerdicts( true ),
+    HitCount( 0 ),
+    MissCount( 0 )
+{
+}
+
+FNamingConventionValidationVerdictCache::~FNamingConventionValidationVerdictCache()
+{
+    ReleaseBatch();
+}
+
+void FNamingConventionValidationVerdictCache::SetWaitsForVerdicts( const bool it_waits_for_verdicts )
+{
+    ItWaitsForVerdicts = it_waits_for_verdicts;
+}
+
+void FNamingConventionValidationVerdictCache::RequestBatch( const TConstArrayView< FAssetData > asset_data_list )
+{
+    ReleaseBatch();
+    ReleaseCompletedLateHandles();
+
+    auto & derived_data_cache = GetDerivedDataCacheRef();
+
+    BatchKeys.Reset( asset_data_list.Num() );
+    BatchHandles.Reset( asset_data_list.Num() );
+
+    for ( const auto & asset_data : asset_data_list )
+    {
+        auto key = MakeKey( asset_data );
+        BatchHandles.Add( key.IsEmpty() ? 0 : derived_data_cache.GetAsynchronous( *key, asset_data.PackageName.ToString() ) );
+        BatchKeys.Add( MoveTemp( key ) );
+    }
+}
+
+bool FNamingConventionValidationVerdictCache::FindVerdict( const int32 batch_asset_index, ENamingConventionValidationResult & result, FName & rule_id, FText & error_message )
+{
+    if ( !BatchHandles.IsValidIndex( batch_asset_index ) || BatchHandles[ batch_asset_index ] == 0 )
+    {
+        return false;
+    }
+
+    auto & derived_data_cache = GetDerivedDataCacheRef();
+    const auto handle = BatchHandles[ batch_asset_index ];
+    BatchHandles[ batch_asset_index ] = 0;
+
+    if ( ItWaitsForVerdicts )
+    {
+        derived_data_cache.WaitAsynchronousCompletion( handle );
+    }
+    else if ( !derived_data_cache.PollAsynchronousCompletion( handle ) )
+    {
+        // The verdict is probably in the cache already, so the local one is not added again
+        ReleaseLateHandle( handle );
+        BatchKeys[ batch_asset_index ].Reset();
+        ++MissCount;
+        return false;
+    }
+
+    TArray< uint8 > data;
+    if ( !derived_data_cache.GetAsynchronousResults( handle, data ) || data.IsEmpty() )
+    {
+        ++MissCount;
+        return false;
+    }
+
+    FMemoryReader reader( data );
+
+    uint8 format_version = 0;
+    uint8 result_value = 0;
+    FString rule_id_string;
+    FString error_message_string;
+    reader << format_version << result_value << rule_id_string << error_message_string;
+
+    if ( reader.IsError() || format_version != VerdictFormatVersion || result_value > static_cast< uint8 >( ENamingConventionValidationResult::Excluded ) )
+    {
+        ++MissCount;
+        return false;
+    }
+
+    result = static_cast< ENamingConventionValidationResult >( result_value );
+    rule_id = FName( *rule_id_string );
+    error_message = FText::FromString( error_message_string );
+    ++HitCount;
+    return true;
+}
+
+void FNamingConventionValidationVerdictCache::AddVerdict( const int32 batch_asset_index, const ENamingConventionValidationResult result, const FName rule_id, const FText & error_message )
+{
+    if ( !BatchKeys.IsValidIndex( batch_asset_index ) || BatchKeys[ batch_asset_index ].IsEmpty() )
+    {
+        return;
+    }
+
+    TArray< uint8 > data;
+    FMemoryWriter writer( data );
+
+    auto format_version = VerdictFormatVersion;
+    auto result_value = static_cast< uint8 >( result );
+    auto rule_id_string = rule_id.ToString();
+    auto error_message_string = error_message.ToString();
+    writer << format_version << result_value << rule_id_string << error_message_string;
+
+    GetDerivedDataCacheRef().Put( *BatchKeys[ batch_asset_index ], TArrayView64< const uint8 >( data.GetData(), data.Num() ), BatchKeys[ batch_asset_index ] );
+}
+
+int32 FNamingConventionValidationVerdictCache::GetHitCount() const
+{
+    return HitCount;
+}
+
+int32 FNamingConventionValidationVerdictCache::GetMissCount() const
+{
+    return MissCount;
+}
+
+FString FNamingConventionValidationVerdictCache::MakeKey( const FAssetData & asset_data ) const
+{
+    // The saved hash does not match the content of a package modified in the editor
+    if ( const auto * package = FindPackage( nullptr, *asset_data.PackageName.ToString() ); package != nullptr && package->IsDirty() )
+    {
+        return FString();
+    }
+
+    const auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName ).Get();
+    const auto package_data = asset_registry.GetAssetPackageDataCopy( asset_data.PackageName );
+    if ( !package_data.IsSet() || package_data->GetPackageSavedHash().IsZero() )
+    {
+        return FString();
+    }
+
+    // The verdict also depends on the hierarchy of the class of the asset, which the package of the asset does not hold when the class is a blueprint class
+    TArray< FTopLevelAssetPath > class_paths;
+    asset_registry.GetAncestorClassNames( asset_data.AssetClassPath, class_paths );
+    class_paths.Insert( asset_data.AssetClassPath, 0 );
+
+    TStringBuilder< 1024 > class_hierarchy;
+    for ( const auto & class_path : class_paths )
+    {
+        TStringBuilder< 256 > class_package_name;
+        class_path.GetPackageName().AppendString( class_package_name );
+
+        // The registry holds the saved hierarchy, not the one of a blueprint reparented in the editor
+        if ( !FPackageName::IsScriptPackage( class_package_name.ToView() ) )
+        {
+            if ( const auto * class_package = FindPackage( nullptr, class_package_name.ToString() ); class_package != nullptr && class_package->IsDirty() )
+            {
+                return FString();
+            }
+        }
+
+        class_path.AppendString( class_hierarchy );
+        class_hierarchy << TEXT( ';' );
+    }
+
+    const auto class_hierarchy_hash = FIoHash::HashBuffer( class_hierarchy.GetData(), class_hierarchy.Len() * sizeof( TCHAR ) );
+
+    // The object path is part of the key, since the verdict depends on the name of the asset and not only on the content of its package
+    return FDerivedDataCacheInterface::BuildCacheKey(
+        TEXT( "NAMINGCONVENTION" ),
+        VerdictCacheVersion,
+        *FString::Printf( TEXT( "%s_%s_%s_%s" ), *Fingerprint, *LexToString( package_data->GetPackageSavedHash() ), *LexToString( class_hierarchy_hash ), *asset_data.GetObjectPathString() ) );
+}
+
+void FNamingConventionValidationVerdictCache::ReleaseBatch()
+{
+    // The results of the requests which were not read must still be retrieved to be released
+    for ( const auto handle : BatchHandles )
+    {
+        if ( handle != 0 )
+        {
+            ReleaseLateHandle( handle );
+        }
+    }
+
+    BatchHandles.Reset();
+    BatchKeys.Reset();
+}
+
+void FNamingConventionValidationVerdictCache::ReleaseLateHandle( const uint32 handle )
+{
+    auto & derived_data_cache = GetDerivedDataCacheRef();
+
+    if ( ItWaitsForVerdicts || derived_data_cache.PollAsynchronousCompletion( handle ) )
+    {
+        TArray< uint8 > data;
+        derived_data_cache.WaitAsynchronousCompletion( handle );
+        derived_data_cache.GetAsynchronousResults( handle, data );
+        return;
+    }
+
+    GetLateHandles().Add( handle );
+}
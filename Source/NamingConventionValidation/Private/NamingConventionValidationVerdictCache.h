@@ -0,0 +1,43 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include <AssetRegistry/AssetData.h>
+#include <CoreMinimal.h>
+
+// Shares the verdicts of the assets through the Derived Data Cache, so the machines using the same shared cache do not validate the same content again.
+// A verdict is keyed by the saved hash of the package of the asset, by the hierarchy of its class, and by the fingerprint of everything the validation depends on.
+// The verdicts of a batch of assets are requested asynchronously together, then read one after the other.
+// Unless it waits for the verdicts, a verdict which is not ready yet is a miss, and the asset is validated locally
+class FNamingConventionValidationVerdictCache
+{
+public:
+    UE_NONCOPYABLE( FNamingConventionValidationVerdictCache );
+
+    explicit FNamingConventionValidationVerdictCache( FString fingerprint );
+    ~FNamingConventionValidationVerdictCache();
+
+    // The background validation does not wait, to stay within its time budget with a remote cache
+    void SetWaitsForVerdicts( bool it_waits_for_verdicts );
+
+    void RequestBatch( TConstArrayView< FAssetData > asset_data_list );
+    // Returns false on a miss, or when the asset can not be cached
+    bool FindVerdict( int32 batch_asset_index, ENamingConventionValidationResult & result, FName & rule_id, FText & error_message );
+    void AddVerdict( int32 batch_asset_index, ENamingConventionValidationResult result, FName rule_id, const FText & error_message );
+
+    int32 GetHitCount() const;
+    int32 GetMissCount() const;
+
+private:
+    FString MakeKey( const FAssetData & asset_data ) const;
+    void ReleaseBatch();
+    void ReleaseLateHandle( uint32 handle );
+
+    FString Fingerprint;
+    // Empty for the assets which can not be cached, like the ones of unsaved packages
+    TArray< FString > BatchKeys;
+    TArray< uint32 > BatchHandles;
+    bool ItWaitsForVerdicts;
+    int32 HitCount;
+    int32 MissCount;
+};
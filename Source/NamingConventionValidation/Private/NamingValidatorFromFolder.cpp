@@ -2,6 +2,48 @@
 
 #include "EditorNamingValidatorSubsystem.h"
 
+#include <String/Find.h>
+
+namespace
+{
+    enum class EFromFolderReason : uint8
+    {
+        None,
+        NotInSameFolder,
+        CannotParseName,
+        MissingIdentifierToken
+    };
+
+    // Names rarely have more tokens than this, which keeps the thread safe path from allocating
+    typedef TArray< FStringView, TInlineAllocator< 16 > > FNameTokens;
+
+    void SplitIntoTokens( FNameTokens & tokens, FStringView view, const TCHAR delimiter )
+    {
+        while ( !view.IsEmpty() )
+        {
+            int32 delimiter_index;
+            if ( !view.FindChar( delimiter, delimiter_index ) )
+            {
+                tokens.Add( view );
+                break;
+            }
+
+            if ( delimiter_index > 0 )
+            {
+                tokens.Add( view.Left( delimiter_index ) );
+            }
+
+            view.RightChopInline( delimiter_index + 1 );
+        }
+    }
+
+    bool IsNativeEventOverriddenInBlueprint( const UClass * validator_class, const FName function_name )
+    {
+        const auto * function = validator_class->FindFunctionByName( function_name );
+        return function != nullptr && !function->GetOwnerClass()->IsNative();
+    }
+}
+
 UNamingValidatorFromFolder::UNamingValidatorFromFolder() :
     bValidateAssetsAreInSameFolder( false ),
     bCheckForRegularAssetNamingValidation( true )
@@ -11,106 +53,168 @@ UNamingValidatorFromFolder::UNamingValidatorFromFolder() :
 
 bool UNamingValidatorFromFolder::CanValidateAssetNaming_Implementation( const UClass * asset_class, const FAssetData & asset_data ) const
 {
-    const auto package_path = asset_data.PackagePath.ToString();
+    TStringBuilder< 256 > package_path;
+    asset_data.PackagePath.AppendString( package_path );
+
+    TStringBuilder< 128 > asset_name;
+    asset_data.AssetName.AppendString( asset_name );
 
-    if ( !package_path.StartsWith( ParentFolderName ) )
+    const FNamingConventionValidationContext context { asset_data, asset_class, asset_name.ToView(), package_path.ToView() };
+    return ValidateAssetNamingThreadSafe( context ).Result != ENamingConventionValidationResult::Unknown;
+}
+
+ENamingConventionValidationResult UNamingValidatorFromFolder::ValidateAssetNaming_Implementation( FText & error_message, const UClass * asset_class, const FAssetData & asset_data ) 
+{
+    TStringBuilder< 256 > package_path;
+    asset_data.PackagePath.AppendString( package_path );
+
+    TStringBuilder< 128 > asset_name;
+    asset_data.AssetName.AppendString( asset_name );
+
+    const FNamingConventionValidationContext context { asset_data, asset_class, asset_name.ToView(), package_path.ToView() };
+    const auto verdict = ValidateAssetNamingThreadSafe( context );
+
+    if ( verdict.Result == ENamingConventionValidationResult::Invalid )
+    {
+        error_message = GetThreadSafeVerdictMessage( context, verdict );
+        return verdict.Result;
+    }
+
+    if ( !bCheckForRegularAssetNamingValidation )
+    {
+        return ENamingConventionValidationResult::Valid;
+    }
+
+    return GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >()->IsAssetNamedCorrectly( error_message, asset_data, false );
+
+}
+
+bool UNamingValidatorFromFolder::IsThreadSafe() const
+{
+    // The regular naming validation and the blueprint overrides can only run on the game thread
+    if ( bCheckForRegularAssetNamingValidation )
     {
         return false;
     }
 
+    return !IsNativeEventOverriddenInBlueprint( GetClass(), GET_FUNCTION_NAME_CHECKED( UEditorNamingValidatorBase, CanValidateAssetNaming ) )
+        && !IsNativeEventOverriddenInBlueprint( GetClass(), GET_FUNCTION_NAME_CHECKED( UEditorNamingValidatorBase, ValidateAssetNaming ) );
+}
+
+FNamingConventionNativeVerdict UNamingValidatorFromFolder::ValidateAssetNamingThreadSafe( const FNamingConventionValidationContext & context ) const
+{
+    FNamingConventionNativeVerdict verdict;
+
+    if ( !context.PackagePath.StartsWith( ParentFolderName ) )
+    {
+        return verdict;
+    }
+
     for ( const auto & ignored_folder : IgnoredFolders )
     {
-        if ( package_path.Contains( ignored_folder ) )
+        if ( UE::String::FindFirst( context.PackagePath, ignored_folder, ESearchCase::IgnoreCase ) != INDEX_NONE )
         {
-            return false;
+            return verdict;
         }
     }
 
-    for ( const auto * ignored_class : IgnoredClasses ) 
+    if ( context.AssetClass != nullptr )
     {
-        if ( asset_class->IsChildOf( ignored_class ) ) 
+        for ( const auto * ignored_class : IgnoredClasses )
         {
-            return false;
+            if ( context.AssetClass->IsChildOf( ignored_class ) )
+            {
+                return verdict;
+            }
         }
     }
-    
 
-    return true;
-
-}
+    verdict.Result = ENamingConventionValidationResult::Invalid;
 
-ENamingConventionValidationResult UNamingValidatorFromFolder::ValidateAssetNaming_Implementation( FText & error_message, const UClass * asset_class, const FAssetData & asset_data ) 
-{
-    const auto package_path = asset_data.PackagePath.ToString();
-    const auto remaining_path = package_path.RightChop( ParentFolderName.Len() );
-
-    TArray< FString > parts;
-    const auto * delimiter = TEXT( "/" );
-    remaining_path.ParseIntoArray( parts, delimiter );
-
-    if ( bValidateAssetsAreInSameFolder && parts.Num() != 1 )
+    if ( bValidateAssetsAreInSameFolder )
     {
-        error_message = FText::FromString( FString::Printf( TEXT( "Assets in the folder %s must all be in the same subfolder" ), *ParentFolderName ) );
-        return ENamingConventionValidationResult::Invalid;
-    }
+        FNameTokens folders;
+        SplitIntoTokens( folders, context.PackagePath.RightChop( ParentFolderName.Len() ), TEXT( '/' ) );
 
-    const auto asset_name = asset_data.AssetName.ToString();
+        if ( folders.Num() != 1 )
+        {
+            verdict.ReasonCode = static_cast< uint8 >( EFromFolderReason::NotInSameFolder );
+            return verdict;
+        }
+    }
 
-    TArray< FString > filename_parts;
-    const auto * filename_delimiter = TEXT( "_" );
+    FNameTokens filename_parts;
+    SplitIntoTokens( filename_parts, context.AssetName, TEXT( '_' ) );
 
-    if ( asset_name.ParseIntoArray( filename_parts, filename_delimiter ) == 0 || filename_parts.Num() < 2 )
+    if ( filename_parts.Num() < 2 )
     {
-        error_message = FText::FromString( FString::Printf( TEXT( "Impossible to parse the filename. Asset name must conform to something like BP_XXX" ) ) );
-        return ENamingConventionValidationResult::Invalid;
+        verdict.ReasonCode = static_cast< uint8 >( EFromFolderReason::CannotParseName );
+        return verdict;
     }
 
     if ( !IdentifierToken.IsEmpty() )
     {
         // If the identifier token contains underscores, we must rework the filename_parts to regroup the tokens to form the identifier
-        TArray< FString > identifier_token_parts;
-        IdentifierToken.ParseIntoArray( identifier_token_parts, TEXT( "_") );
+        FNameTokens identifier_token_parts;
+        SplitIntoTokens( identifier_token_parts, IdentifierToken, TEXT( '_' ) );
         const auto token_count = identifier_token_parts.Num();
 
-        if ( token_count > 1 ) 
+        if ( token_count > 1 )
         {
-            for ( auto filename_token_index = 0; filename_token_index < filename_parts.Num(); ++filename_token_index ) 
+            for ( auto filename_token_index = 0; filename_token_index + token_count <= filename_parts.Num(); ++filename_token_index )
             {
-                const auto token = filename_parts[ filename_token_index ];
-                if ( token == identifier_token_parts[ 0 ] ) 
-                {
-                    auto are_all_tokens_present = true;
+                auto are_all_tokens_present = true;
 
-                    for ( auto identifier_token_index = 1; identifier_token_index < identifier_token_parts.Num(); ++identifier_token_index ) 
+                for ( auto identifier_token_index = 0; identifier_token_index < token_count; ++identifier_token_index )
+                {
+                    if ( !filename_parts[ filename_token_index + identifier_token_index ].Equals( identifier_token_parts[ identifier_token_index ], ESearchCase::IgnoreCase ) )
                     {
-                        if ( filename_parts[ filename_token_index + identifier_token_index ] != identifier_token_parts[ identifier_token_index ] ) 
-                        {
-                            are_all_tokens_present = false;
-                            break;
-                        }
+                        are_all_tokens_present = false;
+                        break;
                     }
+                }
 
-                    if ( are_all_tokens_present ) 
-                    {
-                        filename_parts[ filename_token_index ] = IdentifierToken;
-                        filename_parts.RemoveAt( filename_token_index + 1, identifier_token_parts.Num() - 1 );
-                    }
+                if ( are_all_tokens_present )
+                {
+                    filename_parts[ filename_token_index ] = IdentifierToken;
+                    filename_parts.RemoveAt( filename_token_index + 1, token_count - 1, EAllowShrinking::No );
                 }
             }
         }
 
-        if ( filename_parts[ 1 ] != IdentifierToken ) 
+        if ( filename_parts.Num() < 2 || !filename_parts[ 1 ].Equals( IdentifierToken, ESearchCase::IgnoreCase ) )
         {
-            error_message = FText::FromString( FString::Printf( TEXT( "The name of the asset must start with %s_%s" ), *filename_parts[ 0 ], *IdentifierToken ) );
-            return ENamingConventionValidationResult::Invalid;
+            verdict.ReasonCode = static_cast< uint8 >( EFromFolderReason::MissingIdentifierToken );
+            return verdict;
         }
     }
 
-    if ( !bCheckForRegularAssetNamingValidation )
+    verdict.Result = ENamingConventionValidationResult::Valid;
+    return verdict;
+}
+
+FText UNamingValidatorFromFolder::GetThreadSafeVerdictMessage( const FNamingConventionValidationContext & context, const FNamingConventionNativeVerdict & verdict ) const
+{
+    switch ( static_cast< EFromFolderReason >( verdict.ReasonCode ) )
     {
-        return ENamingConventionValidationResult::Valid;
+        case EFromFolderReason::NotInSameFolder:
+        {
+            return FText::FromString( FString::Printf( TEXT( "Assets in the folder %s must all be in the same subfolder" ), *ParentFolderName ) );
+        }
+        case EFromFolderReason::CannotParseName:
+        {
+            return FText::FromString( FString::Printf( TEXT( "Impossible to parse the filename. Asset name must conform to something like BP_XXX" ) ) );
+        }
+        case EFromFolderReason::MissingIdentifierToken:
+        {
+            FNameTokens filename_parts;
+            SplitIntoTokens( filename_parts, context.AssetName, TEXT( '_' ) );
+            const FString first_token( filename_parts.Num() > 0 ? filename_parts[ 0 ] : FStringView() );
+            return FText::FromString( FString::Printf( TEXT( "The name of the asset must start with %s_%s" ), *first_token, *IdentifierToken ) );
+        }
+        default:
+        {
+            return FText::GetEmpty();
+        }
     }
-
-    return GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >()->IsAssetNamedCorrectly( error_message, asset_data, false );
-
 }
@@ -0,0 +1,138 @@
+#include "SNamingConventionValidationImpactPanel.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationSettings.h"
+
+#include <Editor.h>
+#include <IDetailsView.h>
+#include <Modules/ModuleManager.h>
+#include <PropertyEditorModule.h>
+#include <Widgets/Input/SButton.h>
+#include <Widgets/Input/SMultiLineEditableTextBox.h>
+#include <Widgets/Layout/SSplitter.h>
+#include <Widgets/SBoxPanel.h>
+
+#define LOCTEXT_NAMESPACE "NamingConventionValidationImpactPanel"
+
+void SNamingConventionValidationImpactPanel::Construct( const FArguments & /*arguments*/ )
+{
+    auto & property_editor_module = FModuleManager::LoadModuleChecked< FPropertyEditorModule >( TEXT( "PropertyEditor" ) );
+
+    FDetailsViewArgs details_view_args;
+    details_view_args.bAllowSearch = true;
+    details_view_args.NameAreaSettings = FDetailsViewArgs::HideNameArea;
+    DetailsView = property_editor_module.CreateDetailView( details_view_args );
+
+    ResetCandidateSettings();
+
+    ChildSlot
+    [
+        SNew( SSplitter )
+        .Orientation( Orient_Vertical )
+        + SSplitter::Slot()
+        .Value( 0.6f )
+        [
+            DetailsView.ToSharedRef()
+        ]
+        + SSplitter::Slot()
+        .Value( 0.4f )
+        [
+            SNew( SVerticalBox )
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .Padding( 4.0f )
+            [
+                SNew( SHorizontalBox )
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                .Padding( 0.0f, 0.0f, 4.0f, 0.0f )
+                [
+                    SNew( SButton )
+                    .Text( LOCTEXT( "AnalyzeImpact", "Analyze Impact" ) )
+                    .ToolTipText( LOCTEXT( "AnalyzeImpactTooltip", "Evaluates the settings above on all the assets of the project, and lists the assets whose verdict would change." ) )
+                    .OnClicked( this, &SNamingConventionValidationImpactPanel::OnAnalyzeClicked )
+                ]
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                [
+                    SNew( SButton )
+                    .Text( LOCTEXT( "ResetCandidateSettings", "Reset to Current Settings" ) )
+                    .OnClicked( this, &SNamingConventionValidationImpactPanel::OnResetClicked )
+                ]
+            ]
+            + SVerticalBox::Slot()
+            .FillHeight( 1.0f )
+            .Padding( 4.0f )
+            [
+                SNew( SMultiLineEditableTextBox )
+                .IsReadOnly( true )
+                .Text( this, &SNamingConventionValidationImpactPanel::GetReportText )
+            ]
+        ]
+    ];
+}
+
+void SNamingConventionValidationImpactPanel::ResetCandidateSettings()
+{
+    // A new object starts from the values of the class default object, which holds the current settings
+    CandidateSettings.Reset( NewObject< UNamingConventionValidationSettings >( GetTransientPackage(), NAME_None, RF_Transient ) );
+    CandidateSettings->PostProcessSettings();
+
+    DetailsView->SetObject( CandidateSettings.Get() );
+    ReportText = FText::GetEmpty();
+}
+
+FReply SNamingConventionValidationImpactPanel::OnAnalyzeClicked()
+{
+    // The list of changes can be long, the commandlet lists all of them
+    static const int32 MaxListedChanges = 1000;
+
+    auto * editor_validation_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
+    if ( editor_validation_subsystem == nullptr )
+    {
+        return FReply::Handled();
+    }
+
+    CandidateSettings->PostProcessSettings();
+
+    FNamingConventionSettingsImpact impact;
+    if ( !editor_validation_subsystem->AnalyzeSettingsImpact( impact, *CandidateSettings ) )
+    {
+        ReportText = LOCTEXT( "ImpactAssetsStillScanning", "Cannot analyze the impact of the settings while still discovering assets." );
+        return FReply::Handled();
+    }
+
+    TArray< FString > lines;
+    impact.GetReportLines( lines );
+
+    if ( !impact.Changes.IsEmpty() )
+    {
+        lines.AddDefaulted();
+    }
+
+    for ( auto change_index = 0; change_index < FMath::Min( impact.Changes.Num(), MaxListedChanges ); ++change_index )
+    {
+        lines.Add( impact.Changes[ change_index ].ToString() );
+    }
+
+    if ( impact.Changes.Num() > MaxListedChanges )
+    {
+        lines.Add( FString::Printf( TEXT( "... and %i more" ), impact.Changes.Num() - MaxListedChanges ) );
+    }
+
+    ReportText = FText::FromString( FString::Join( lines, TEXT( "\n" ) ) );
+    return FReply::Handled();
+}
+
+FReply SNamingConventionValidationImpactPanel::OnResetClicked()
+{
+    ResetCandidateSettings();
+    return FReply::Handled();
+}
+
+FText SNamingConventionValidationImpactPanel::GetReportText() const
+{
+    return ReportText;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <CoreMinimal.h>
+#include <UObject/StrongObjectPtr.h>
+#include <Widgets/SCompoundWidget.h>
+
+class IDetailsView;
+class UNamingConventionValidationSettings;
+
+// Edits a copy of the settings, and shows how the verdicts of the assets of the project would change with it, without changing the settings
+class SNamingConventionValidationImpactPanel final : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS( SNamingConventionValidationImpactPanel )
+    {}
+    SLATE_END_ARGS()
+
+    void Construct( const FArguments & arguments );
+
+private:
+    void ResetCandidateSettings();
+    FReply OnAnalyzeClicked();
+    FReply OnResetClicked();
+    FText GetReportText() const;
+
+    TStrongObjectPtr< UNamingConventionValidationSettings > CandidateSettings;
+    TSharedPtr< IDetailsView > DetailsView;
+    FText ReportText;
+};
@@ -2,11 +2,29 @@
 
 #include "NamingConventionValidationTypes.h"
 
+#include <AssetRegistry/AssetData.h>
 #include <CoreMinimal.h>
 #include <UObject/NoExportTypes.h>
 
 #include "EditorNamingValidatorBase.generated.h"
 
+// What thread safe validators get to validate an asset. The views are only valid during the call
+struct FNamingConventionValidationContext
+{
+    const FAssetData & AssetData;
+    const UClass * AssetClass;
+    FStringView AssetName;
+    FStringView PackagePath;
+};
+
+struct FNamingConventionNativeVerdict
+{
+    // Unknown when the validator does not handle the asset
+    ENamingConventionValidationResult Result = ENamingConventionValidationResult::Unknown;
+    // Validator specific code, which GetThreadSafeVerdictMessage turns into an error message
+    uint8 ReasonCode = 0;
+};
+
 UCLASS( Abstract, Blueprintable, meta = (ShowWorldContextPin) )
 class NAMINGCONVENTIONVALIDATION_API UEditorNamingValidatorBase : public UObject
 {
@@ -23,6 +41,16 @@ public:
 
     virtual bool IsEnabled() const;
 
+    // Native validators return true when they implement ValidateAssetNamingThreadSafe.
+    // They are then evaluated on worker threads instead of going through CanValidateAssetNaming and ValidateAssetNaming
+    virtual bool IsThreadSafe() const;
+
+    // Must be thread safe, and must not allocate memory
+    virtual FNamingConventionNativeVerdict ValidateAssetNamingThreadSafe( const FNamingConventionValidationContext & context ) const;
+
+    // Called on the game thread to describe a verdict returned by ValidateAssetNamingThreadSafe
+    virtual FText GetThreadSafeVerdictMessage( const FNamingConventionValidationContext & context, const FNamingConventionNativeVerdict & verdict ) const;
+
 protected:
     UPROPERTY( EditAnywhere, Category = "Asset Validation", meta = ( BlueprintProtected = true ), DisplayName = "IsEnabled" )
     uint8 ItIsEnabled : 1;
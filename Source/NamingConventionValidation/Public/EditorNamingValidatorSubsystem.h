@@ -1,15 +1,85 @@
 #pragma once
 
+#include "EditorNamingValidatorBase.h"
+#include "NamingConventionValidationCompiledMatcher.h"
+#include "NamingConventionValidationDuplicateNameIndex.h"
+#include "NamingConventionValidationImpact.h"
+#include "NamingConventionValidationResultStore.h"
+#include "NamingConventionValidationRuleOverlays.h"
 #include "NamingConventionValidationTypes.h"
 
+#include <Containers/Ticker.h>
 #include <CoreMinimal.h>
 #include <EditorSubsystem.h>
 
 #include "EditorNamingValidatorSubsystem.generated.h"
 
-class UEditorNamingValidatorBase;
+class FNamingConventionValidationBaseline;
+class FNamingConventionValidationBudget;
+class FNamingConventionValidationRun;
+class SNotificationItem;
+class UBlueprint;
+class UFactory;
+class UNamingConventionRuleDataAsset;
+class UNamingConventionValidationAsyncAction;
+class UNamingConventionValidationSettings;
 struct FAssetData;
 
+// Result of the prefixes and suffixes of the settings for one asset, matched for the whole batch at once
+struct FNamingConventionNameVerdict
+{
+    // Unknown when no class description applies to the asset class
+    ENamingConventionValidationResult ClassDescriptionsResult = ENamingConventionValidationResult::Unknown;
+    // The class descriptions of the folder of the asset, from GetClassDescriptions
+    int32 ClassDescriptionSetIndex = INDEX_NONE;
+    // The class description the asset does not comply with, when the result is Invalid
+    int32 FailedClassDescriptionIndex = INDEX_NONE;
+    bool ItHasWrongSuffix = false;
+    bool ItHasEvaluatedClassDescriptions = false;
+    bool ItHasEvaluatedBlueprintsPrefix = false;
+    bool ItMatchesBlueprintsPrefix = false;
+};
+
+// Verdicts of the thread safe validators for one asset, precomputed on worker threads
+struct FNamingConventionAssetBatchVerdicts
+{
+    // The class the verdicts were evaluated with. They are only used if the asset resolves to that same class
+    const UClass * AssetClass = nullptr;
+    // One verdict per thread safe validator
+    TConstArrayView< FNamingConventionNativeVerdict > Verdicts;
+    FNamingConventionNameVerdict NameVerdict;
+    // The thread safe validators which were disabled by the budget, and have no verdict
+    const TBitArray<> * DisabledValidators = nullptr;
+};
+
+// Verdicts of the thread safe validators and of the class descriptions for a batch of assets, filled by EvaluateAssetBatch
+struct FNamingConventionBatchVerdicts
+{
+    FNamingConventionAssetBatchVerdicts GetAssetVerdicts( const int32 asset_index ) const
+    {
+        return { AssetClasses[ asset_index ], MakeArrayView( Verdicts.GetData() + asset_index * ValidatorCount, ValidatorCount ), NameVerdicts[ asset_index ], &DisabledValidators };
+    }
+
+    // nullptr when the class of the asset was not loaded yet
+    TArray< const UClass * > AssetClasses;
+    TArray< FNamingConventionNativeVerdict > Verdicts;
+    TArray< FNamingConventionNameVerdict > NameVerdicts;
+    TBitArray<> DisabledValidators;
+    int32 ValidatorCount = 0;
+};
+
+// Time spent matching the names of the same assets against the class descriptions of the settings, filled by BenchmarkCompiledMatcher
+struct FNamingConventionMatcherBenchmark
+{
+    int32 AssetCount = 0;
+    int32 IterationCount = 0;
+    double DynamicSeconds = 0.0;
+    // The compiled matcher walking the class hierarchy of each asset
+    double CompiledSeconds = 0.0;
+    // The compiled matcher looking up each class once in a FNamingConventionCompiledClassCache
+    double CachedCompiledSeconds = 0.0;
+};
+
 UCLASS( Config = Editor )
 class NAMINGCONVENTIONVALIDATION_API UEditorNamingValidatorSubsystem final : public UEditorSubsystem
 {
@@ -21,20 +91,106 @@ public:
     void Initialize( FSubsystemCollectionBase & collection ) override;
     void Deinitialize() override;
 
+    // Gets the assets of the paths and their sub-folders, leaving out the folders and classes the settings exclude from validation
+    void GetAssetsToValidate( TArray< FAssetData > & asset_data_list, TArrayView< const FString > paths ) const;
     int32 ValidateAssets( const TArray< FAssetData > & asset_data_list, bool skip_excluded_directories = true, bool show_if_no_failures = true ) const;
+    // Validates a single asset without reporting it to the message log, for the callers which report the verdict themselves. The result is stored like the ones of ValidateAssets
+    ENamingConventionValidationResult ValidateAsset( FText & error_message, FName & rule_id, const FAssetData & asset_data ) const;
+    // Returns the number of violations which are not part of the baseline. All the violations get recorded in the baseline
+    int32 ValidateAssetsWithBaseline( const TArray< FAssetData > & asset_data_list, FNamingConventionValidationBaseline & baseline, bool show_if_no_failures = true ) const;
+    // Validates the assets of the paths while the asset registry discovers them, in place of scanning the paths before validating them.
+    // The registry gathers the assets on its own thread, and each group of assets it adds is validated while it gathers the next ones.
+    // The registry scans all the mount points of the project, the paths first, so it can be slower than scanning narrow paths before validating them.
+    // Validates the same assets as GetAssetsToValidate. Returns the number of invalid assets, which are not part of the baseline when there is one
+    int32 ValidateAssetsWhileScanning( TArrayView< const FString > paths, FNamingConventionValidationBaseline * baseline = nullptr, bool show_if_no_failures = true ) const;
+    // Validates the assets over several frames, within the time budget of the settings, without blocking the editor.
+    // The results are streamed to the message log. Lists added while another one is validated are queued.
+    // The callbacks of the returned run can be set until the next tick
+    TSharedRef< FNamingConventionValidationRun > ValidateAssetsInBackground( TArray< FAssetData > asset_data_list, bool show_if_no_failures = true );
+    void CancelBackgroundValidation();
+    bool IsValidatingInBackground() const;
+    // Nothing else references the async actions while their validation runs. They are released when it finishes, or when the subsystem is deinitialized
+    void AddActiveAsyncAction( UNamingConventionValidationAsyncAction * action );
+    void RemoveActiveAsyncAction( UNamingConventionValidationAsyncAction * action );
+    // Gets the assets whose naming depends on the rules of the classes: the assets of the classes and of their child classes, and the blueprints deriving from them
+    void GetAssetsDependingOnClasses( TArray< FAssetData > & asset_data_list, TConstArrayView< FTopLevelAssetPath > class_paths ) const;
+    // Validates again in background the assets depending on the classes, and reports the assets whose result changed
+    void RevalidateAssetsDependingOnClasses( TConstArrayView< FTopLevelAssetPath > class_paths );
+    // The result of the latest validation of each package, from all the validations ran in the editor or by the commandlet
+    const FNamingConventionValidationResultStore & GetValidationResults() const;
+    // Broadcast by the result store, whichever validation changed the results
+    FSimpleMulticastDelegate & OnValidationResultsChanged();
+    UFUNCTION( BlueprintCallable, Category = "Asset Naming Validation" )
+    bool FindValidationResult( FNamingConventionValidationStoredResult & result, FName package_name ) const;
+    // Returns the results of the packages in the folder and its sub-folders, without validating them again
+    UFUNCTION( BlueprintCallable, Category = "Asset Naming Validation" )
+    TArray< FNamingConventionValidationStoredResult > GetValidationResultsInPath( const FString & path, bool only_invalid_results = false ) const;
     void ValidateSavedPackage( FName package_name );
     void AddValidator( UEditorNamingValidatorBase * validator );
+    // Compiles the rule again, and validates the assets it can affect
+    void RegisterRule( UNamingConventionRuleDataAsset * rule );
     ENamingConventionValidationResult IsAssetNamedCorrectly( FText & error_message, const FAssetData & asset_data, bool can_use_editor_validators = true ) const;
+    // rule_id identifies the rule the asset does not comply with when the result is Invalid.
+    // batch_verdicts can come from EvaluateAssetBatch, to not evaluate the thread safe validators again.
+    // validation_budget times the validators, and skips the ones it disabled
+    ENamingConventionValidationResult IsAssetNamedCorrectly( FText & error_message, FName & rule_id, const FAssetData & asset_data, bool can_use_editor_validators = true, const FNamingConventionAssetBatchVerdicts * batch_verdicts = nullptr, FNamingConventionValidationBudget * validation_budget = nullptr ) const;
+    // Evaluates the validators which are thread safe on worker threads, and matches the names of all the assets against the prefixes and suffixes of the settings.
+    // Only the classes which are already loaded are used, the assets of the other classes get evaluated on the game thread by IsAssetNamedCorrectly
+    void EvaluateAssetBatch( FNamingConventionBatchVerdicts & verdicts, TConstArrayView< FAssetData > asset_data_list, FNamingConventionValidationBudget * validation_budget = nullptr ) const;
+    // Hash of the settings, of the validators and of the rules, and of the versions of the plugins or of the project which implement them.
+    // It changes when the verdict of an asset can change. Cached until the settings, the validators or the rules change
+    FString GetVerdictFingerprint() const;
+    // Compares the verdicts of the current settings with the ones of the candidate settings on all the assets of the project, without changing the settings.
+    // Only what the settings decide is evaluated: the excluded folders and classes, the class descriptions and the blueprints prefix.
+    // The classes of the candidate settings must be loaded, like after PostProcessSettings. Returns false while the assets are discovered
+    bool AnalyzeSettingsImpact( FNamingConventionSettingsImpact & impact, const UNamingConventionValidationSettings & candidate_settings );
+    // Whether the registry query of GetAssetsToValidate excludes the class of the asset, or one of its ancestors.
+    // Cached per class until the settings change, once the registry knows the ancestors of the class
+    bool IsAssetClassExcludedFromQuery( const FAssetData & asset_data ) const;
+    // Times the matching of the names of the assets of loaded classes against the class descriptions of the settings, iteration_count times with each matcher.
+    // Returns false when no compiled matcher was generated from the current class descriptions
+    bool BenchmarkCompiledMatcher( FNamingConventionMatcherBenchmark & benchmark, TConstArrayView< FAssetData > asset_data_list, int32 iteration_count ) const;
 
 private:
+    int32 ValidateAssetsInternal( FNamingConventionValidationRun & run ) const;
+    bool TickBackgroundValidation( float delta_time );
     void RegisterBlueprintValidators();
+    void RegisterRuleAssets();
+    void AddRule( UNamingConventionRuleDataAsset * rule );
+    // Validates again the assets a rule applied to or applies to
+    void RevalidateAssetsOfRuleClasses( TConstArrayView< FTopLevelAssetPath > class_paths, bool it_applies_to_all_classes );
     void CleanupValidators();
+    void SortValidators();
     void ValidateAllSavedPackages();
-    void ValidateOnSave( const TArray< FAssetData > & asset_data_list ) const;
-    ENamingConventionValidationResult DoesAssetMatchNameConvention( FText & error_message, const FAssetData & asset_data, FName asset_class, bool can_use_editor_validators = true ) const;
+    void ValidateOnSave( const TArray< FAssetData > & asset_data_list );
+    void OnAssetPostImport( UFactory * factory, UObject * asset );
+    void ValidateImportedAssets();
+    void ApplyAffixesToImportedAssets( TConstArrayView< UObject * > imported_assets ) const;
+    // Returns false when the name already matches the class description of the asset, or when no class description applies to it
+    bool GetNameWithClassDescriptionAffixes( FString & fixed_name, const UObject & asset ) const;
+    bool UpdateProjectAssetNamesIndex();
+    bool UpdateImpactSnapshot();
+    void OnAssetAdded( const FAssetData & asset_data );
+    void OnAssetRemoved( const FAssetData & asset_data );
+    void OnAssetRenamed( const FAssetData & asset_data, const FString & old_object_path );
+    void OnSettingsChanged( UObject * settings, FPropertyChangedEvent & property_changed_event );
+    void GatherClassRuleHashes( TMap< FTopLevelAssetPath, uint32 > & class_rule_hashes ) const;
+    void UpdateCompiledMatcher();
+    FString ComputeVerdictFingerprint() const;
+    void InvalidateVerdictFingerprint();
+    void ResetCompiledClassCache();
+    void OnBlueprintPreCompile( UBlueprint * blueprint );
+    ENamingConventionValidationResult DoesExternalActorMatchNameConvention( FText & error_message, FName & rule_id, const FAssetData & asset_data ) const;
+    ENamingConventionValidationResult DoesAssetMatchNameConvention( FText & error_message, FName & rule_id, const FAssetData & asset_data, FName asset_class, bool can_use_editor_validators, const FNamingConventionAssetBatchVerdicts * batch_verdicts, FNamingConventionValidationBudget * validation_budget ) const;
     bool IsClassExcluded( FText & error_message, const UClass * asset_class ) const;
-    ENamingConventionValidationResult DoesAssetMatchesClassDescriptions( FText & error_message, const UClass * asset_class, const FString & asset_name ) const;
-    ENamingConventionValidationResult DoesAssetMatchesValidators( FText & error_message, const UClass * asset_class, const FAssetData & asset_data ) const;
+    ENamingConventionValidationResult DoesAssetMatchesClassDescriptions( FText & error_message, FName & rule_id, TConstArrayView< FNamingConventionValidationClassDescription > class_descriptions, const UClass * asset_class, FStringView asset_name ) const;
+    // The class descriptions of the settings for INDEX_NONE, else the ones of the rule overlays
+    TConstArrayView< FNamingConventionValidationClassDescription > GetClassDescriptions( int32 class_description_set_index ) const;
+    ENamingConventionValidationResult GetClassDescriptionsResult( FText & error_message, FName & rule_id, const FNamingConventionNameVerdict & name_verdict ) const;
+    // The invalid class descriptions are left to DoesAssetMatchesClassDescriptions which reports them, unless they are ignored
+    void EvaluateNamesBatch( FNamingConventionBatchVerdicts & verdicts, TConstArrayView< FAssetData > asset_data_list, const UNamingConventionValidationSettings & settings, const FNamingConventionValidationRuleOverlays & rule_overlays, bool ignores_invalid_class_descriptions ) const;
+    ENamingConventionValidationResult DoesAssetMatchesRules( FText & error_message, FName & rule_id, const UClass * asset_class, const FAssetData & asset_data, FStringView asset_name ) const;
+    ENamingConventionValidationResult DoesAssetMatchesValidators( FText & error_message, FName & rule_id, const UClass * asset_class, const FAssetData & asset_data, const FNamingConventionAssetBatchVerdicts * batch_verdicts, FNamingConventionValidationBudget * validation_budget ) const;
 
     UPROPERTY( config )
     uint8 AllowBlueprintValidators : 1;
@@ -42,5 +198,58 @@ private:
     UPROPERTY( Transient )
     TMap< UClass *, UEditorNamingValidatorBase * > Validators;
 
+    // Sorted by path, so the rules are always evaluated in the same order
+    UPROPERTY( Transient )
+    TArray< UNamingConventionRuleDataAsset * > Rules;
+
+    // The validators of Validators which can be evaluated on worker threads
+    TArray< UEditorNamingValidatorBase * > ThreadSafeValidators;
+
+    // The validators of Validators in the order they are evaluated, cheapest first
+    TArray< UEditorNamingValidatorBase * > SortedValidators;
+    // The index in ThreadSafeValidators of each validator of SortedValidators, or INDEX_NONE
+    TArray< int32 > SortedValidatorThreadSafeIndices;
+
     TArray< FName > SavedPackagesToValidate;
+    // The assets of the current import, validated together at the next tick
+    TArray< TWeakObjectPtr< UObject > > ImportedAssetsToValidate;
+
+    // Names of all the validated assets of the project, built on the first validation on save, then kept up to date from the asset registry events
+    FNamingConventionValidationDuplicateNameIndex ProjectAssetNamesIndex;
+    bool ItHasBuiltProjectAssetNamesIndex;
+
+    // The assets the impact of candidate settings is evaluated on, built on the first analysis, then kept up to date from the asset registry events
+    FNamingConventionValidationImpactSnapshot ImpactSnapshot;
+    bool ItHasBuiltImpactSnapshot;
+
+    // The class descriptions of each folder with rule overlays, rebuilt when the settings change
+    FNamingConventionValidationRuleOverlays RuleOverlays;
+
+    // The tables of the generated module which match the current class descriptions of the settings, if any
+    const FNamingConventionCompiledMatcherTable * CompiledMatcherTable = nullptr;
+
+    // The compiled class of the classes of the validated assets, filled by the validations, which are const
+    mutable FNamingConventionCompiledClassCache CompiledClassCache;
+
+    // Hash of the class descriptions and of the exclusion of each class of the settings, to find the classes affected by a change of the settings
+    TMap< FTopLevelAssetPath, uint32 > ClassRuleHashes;
+
+    // Updated by the validations, which are const
+    mutable FNamingConventionValidationResultStore ValidationResults;
+
+    // Empty until GetVerdictFingerprint computes it
+    mutable FString VerdictFingerprint;
+
+    // The classes of the settings the registry query excludes, and the result of IsAssetClassExcludedFromQuery for each class. Emptied when the settings change
+    mutable TSet< FTopLevelAssetPath > QueryExcludedClassPaths;
+    mutable TMap< FTopLevelAssetPath, bool > IsQueryExcludedByClassPath;
+
+    TArray< TSharedRef< FNamingConventionValidationRun > > BackgroundValidationRuns;
+
+    UPROPERTY( Transient )
+    TArray< UNamingConventionValidationAsyncAction * > ActiveAsyncActions;
+
+    FTSTicker::FDelegateHandle BackgroundValidationTickerHandle;
+    TSharedPtr< SNotificationItem > BackgroundValidationNotification;
+    double LastBackgroundValidationProgressTime;
 };
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include <CoreMinimal.h>
+#include <Engine/DataAsset.h>
+#include <Engine/EngineTypes.h>
+
+#include "NamingConventionRuleDataAsset.generated.h"
+
+USTRUCT()
+struct FNamingConventionTokenConstraint
+{
+    GENERATED_USTRUCT_BODY()
+
+    FNamingConventionTokenConstraint() :
+        Position( 0 ),
+        bIsCaseSensitive( false )
+    {}
+
+    // Index of the token in the asset name. Negative values start from the end: -1 is the last token
+    UPROPERTY( EditAnywhere )
+    int32 Position;
+
+    // The token must be one of those. When empty, the token only has to exist
+    UPROPERTY( EditAnywhere )
+    TArray< FString > AllowedTokens;
+
+    UPROPERTY( EditAnywhere )
+    uint8 bIsCaseSensitive : 1;
+};
+
+// Naming rule described with data, for the rules which do not need the flexibility of a UEditorNamingValidatorBase blueprint.
+// The rule assets are found with the asset registry, and evaluated natively by UEditorNamingValidatorSubsystem
+UCLASS( BlueprintType )
+class NAMINGCONVENTIONVALIDATION_API UNamingConventionRuleDataAsset final : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UNamingConventionRuleDataAsset();
+
+    // Builds the lookup tables used by ValidateAssetName. The classes are matched by path, so none of them is loaded
+    void CompileRule();
+    bool IsEnabled() const;
+    FName GetRuleId() const;
+    // Empty when the rule applies to all the classes
+    const TArray< FTopLevelAssetPath > & GetClassPaths() const;
+
+    // Returns Unknown when the rule does not apply to the asset
+    ENamingConventionValidationResult ValidateAssetName( FText & error_message, const UClass * asset_class, FStringView package_path, FStringView asset_name ) const;
+
+#if WITH_EDITOR
+    void PostEditChangeProperty( FPropertyChangedEvent & property_changed_event ) override;
+#endif
+
+protected:
+    UPROPERTY( EditAnywhere )
+    uint8 bIsEnabled : 1;
+
+    // The folders the rule applies to, with their sub-folders. The rule applies to all the folders when empty
+    UPROPERTY( EditAnywhere, meta = ( LongPackageName ) )
+    TArray< FDirectoryPath > Folders;
+
+    // The classes the rule applies to, with their child classes. The rule applies to all the classes when empty
+    UPROPERTY( EditAnywhere, meta = ( AllowAbstract = true ) )
+    TArray< TSoftClassPtr< UObject > > Classes;
+
+    // Separates the tokens of the asset names
+    UPROPERTY( EditAnywhere )
+    FString TokenSeparator;
+
+    UPROPERTY( EditAnywhere )
+    TArray< FNamingConventionTokenConstraint > TokenConstraints;
+
+    // The only characters the asset names can use. All the characters are allowed when empty
+    UPROPERTY( EditAnywhere )
+    FString AllowedCharacters;
+
+private:
+    bool IsCharacterAllowed( TCHAR character ) const;
+
+    TArray< FTopLevelAssetPath > ClassPaths;
+    TArray< FString > FolderPrefixes;
+    // One bit per ASCII character, the other allowed characters are in a sorted array
+    uint64 AllowedAsciiCharacters[ 2 ];
+    TArray< TCHAR > AllowedNonAsciiCharacters;
+    FName RuleId;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include <AssetRegistry/AssetData.h>
+#include <CoreMinimal.h>
+#include <Kismet/BlueprintAsyncActionBase.h>
+
+#include "NamingConventionValidationAsyncAction.generated.h"
+
+class FNamingConventionValidationRun;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams( FNamingConventionValidationProgressDelegate, int32, ProcessedCount, int32, TotalCount );
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam( FNamingConventionValidationVerdictsDelegate, const TArray< FNamingConventionValidationVerdict > &, Verdicts );
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams( FNamingConventionValidationCompletedDelegate, int32, InvalidCount, bool, WasCancelled );
+
+// Validates assets in background from Blueprint or Python, without blocking the editor.
+// The verdicts are delivered in chunks, once per frame, while the validation progresses
+UCLASS()
+class NAMINGCONVENTIONVALIDATION_API UNamingConventionValidationAsyncAction final : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION( BlueprintCallable, Category = "Asset Naming Validation", meta = ( BlueprintInternalUseOnly = "true" ) )
+    static UNamingConventionValidationAsyncAction * ValidateAssetsAsync( const TArray< FAssetData > & assets, bool report_to_message_log = false );
+
+    // Validates the assets of the paths and their sub-folders, except the ones excluded in the settings
+    UFUNCTION( BlueprintCallable, Category = "Asset Naming Validation", meta = ( BlueprintInternalUseOnly = "true" ) )
+    static UNamingConventionValidationAsyncAction * ValidatePathsAsync( const TArray< FString > & paths, bool report_to_message_log = false );
+
+    void Activate() override;
+
+    UFUNCTION( BlueprintCallable, Category = "Asset Naming Validation" )
+    void Cancel();
+
+    UPROPERTY( BlueprintAssignable )
+    FNamingConventionValidationProgressDelegate OnProgress;
+
+    UPROPERTY( BlueprintAssignable )
+    FNamingConventionValidationVerdictsDelegate OnVerdicts;
+
+    UPROPERTY( BlueprintAssignable )
+    FNamingConventionValidationCompletedDelegate OnCompleted;
+
+private:
+    TArray< FAssetData > Assets;
+    TArray< FString > Paths;
+    TWeakPtr< FNamingConventionValidationRun > Run;
+    uint8 ItReportsToMessageLog : 1;
+};
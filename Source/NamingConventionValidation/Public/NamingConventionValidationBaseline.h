@@ -0,0 +1,69 @@
+#pragma once
+
+#include <CoreMinimal.h>
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// Known naming convention violations (package name + rule id) which must not fail the validation.
+// The file stores the sorted hashes of the violations and is memory mapped, so looking up a violation is a binary search
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationBaseline
+{
+public:
+    FNamingConventionValidationBaseline();
+    ~FNamingConventionValidationBaseline();
+
+    // Returns false if the file does not exist or is not a valid baseline, in which case the baseline is empty
+    bool Load( const FString & file_path );
+
+    // Writes the known violations which are still present, and the ones outside of validated_paths which were not checked.
+    // If no baseline was loaded, all the recorded violations are written. The baseline is unloaded afterwards
+    bool Save( const FString & file_path, TArrayView< const FString > validated_paths );
+
+    // Records the violation, and returns true if it's part of the baseline
+    bool RecordViolation( FName package_name, FName rule_id );
+
+    bool IsLoaded() const;
+    int32 Num() const;
+    int32 GetKnownViolationCount() const;
+    int32 GetNewViolationCount() const;
+    // Returns the number of violations of the baseline located in validated_paths which were not recorded
+    int32 GetFixedViolationCount( TArrayView< const FString > validated_paths ) const;
+
+private:
+    struct FHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+        uint32 EntryCount;
+        uint32 StringsSize;
+    };
+
+    static const uint32 FileMagic;
+    static const uint32 FileVersion;
+
+    // Lower case "PackageName<TAB>RuleId", stored as UTF-8 in the file
+    static FString MakeKey( FName package_name, FName rule_id );
+    static uint64 HashKey( const FTCHARToUTF8 & key );
+
+    bool BindData( const uint8 * data, int64 size );
+    void Unload();
+    const ANSICHAR * GetEntryKey( int32 index ) const;
+    bool IsEntryInPaths( int32 index, TArrayView< const FString > paths ) const;
+
+    TUniquePtr< IMappedFileHandle > MappedFile;
+    TUniquePtr< IMappedFileRegion > MappedRegion;
+    // Used when the platform can not memory map the file
+    TArray64< uint8 > FileData;
+
+    TArrayView< const uint64 > Hashes;
+    TArrayView< const uint32 > StringOffsets;
+    const ANSICHAR * Strings;
+    uint32 StringsSize;
+
+    TBitArray<> RecordedEntries;
+    // Only filled when no baseline is loaded, to be able to create one
+    TSet< FString > RecordedViolations;
+    int32 KnownViolationCount;
+    int32 NewViolationCount;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <CoreMinimal.h>
+
+class UEditorNamingValidatorBase;
+
+// Times the validators during a validation run. A validator whose call, or whose total time during the run, exceeds the budgets of the settings
+// is disabled until the end of the run, and the assets validated after that are reported as not evaluated by it
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationBudget
+{
+public:
+    FNamingConventionValidationBudget();
+
+    // Reads the budgets of the settings, and enables all the validators again
+    void Reset();
+
+    bool IsValidatorDisabled( const UEditorNamingValidatorBase * validator ) const;
+    // Disables the validator when the call makes it exceed a budget
+    void AddValidatorCall( const UEditorNamingValidatorBase * validator, double call_seconds );
+
+    // The skipped validators are those of the current asset
+    void BeginAsset();
+    void AddSkippedValidator( const UEditorNamingValidatorBase * validator );
+    TConstArrayView< const UEditorNamingValidatorBase * > GetSkippedValidators() const;
+
+    bool HasDisabledValidators() const;
+    // One line per disabled validator, with its timings
+    void GetReportLines( TArray< FString > & lines ) const;
+
+private:
+    struct FValidatorTiming
+    {
+        double TotalSeconds = 0.0;
+        double MaxCallSeconds = 0.0;
+        int32 CallCount = 0;
+        int32 SkippedCount = 0;
+        bool ItIsDisabled = false;
+    };
+
+    TMap< const UEditorNamingValidatorBase *, FValidatorTiming > ValidatorTimings;
+    TArray< const UEditorNamingValidatorBase * > SkippedValidators;
+    // 0 when there is no budget
+    double CallTimeBudget;
+    double RunTimeBudget;
+    bool ItHasDisabledValidators;
+};
@@ -17,5 +17,18 @@ public:
     int32 Main( const FString & params ) override;
     // End UCommandlet Interface
 
-    static bool ValidateData( TArrayView<FString> paths );
+    // validate_while_scanning validates the assets as the asset registry discovers them, instead of after the scan of all the paths
+    static bool ValidateData( TArrayView<FString> paths, const FString & baseline_file_path = FString(), bool update_baseline = false, bool validate_while_scanning = false );
+    // Returns when a client requests the daemon to shut down
+    static bool RunDaemon( int32 port );
+    // Logs how the verdicts would change with the settings of the ini file, which holds a section like the one of DefaultEditor.ini. Nothing is validated nor changed
+    static bool AnalyzeSettingsImpact( const FString & candidate_settings_file_path );
+    // Writes a module which matches the names against the current class descriptions of the settings with compiled tables
+    static bool GenerateMatcher( const FString & module_directory, const FString & module_name );
+    // Logs the time spent matching the names of the assets of the paths dynamically and with the compiled matcher, without validating them
+    static bool BenchmarkMatcher( TArrayView< FString > paths, int32 iteration_count );
+
+    static constexpr int32 DefaultDaemonPort = 41730;
+    static constexpr int32 DefaultBenchmarkIterationCount = 10;
+    static constexpr const TCHAR * DefaultMatcherModuleName = TEXT( "NamingConventionCompiledMatcher" );
 };
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "NamingConventionValidationMemory.h"
+#include "NamingConventionValidationTypes.h"
+
+#include <CoreMinimal.h>
+
+class UNamingConventionValidationSettings;
+
+// The tables of a module generated from the class descriptions of the settings by GenerateModule. They are constexpr in the generated module,
+// which registers them when it starts
+struct FNamingConventionCompiledClass
+{
+    const TCHAR * ClassPath;
+    int32 ClassPathLength;
+    // The class descriptions of the class are contiguous, in the order of the settings
+    int32 FirstClassDescription;
+    int32 ClassDescriptionCount;
+};
+
+struct FNamingConventionCompiledClassDescription
+{
+    // The index of the class description in the class descriptions of the settings
+    int32 ClassDescriptionIndex;
+    const TCHAR * Prefix;
+    int32 PrefixLength;
+    const TCHAR * Suffix;
+    int32 SuffixLength;
+};
+
+struct FNamingConventionCompiledMatcherTable
+{
+    // From GetClassDescriptionsFingerprint, the table is only used while the class descriptions of the settings have the same fingerprint
+    const TCHAR * ClassDescriptionsFingerprint;
+    const FNamingConventionCompiledClass * Classes;
+    int32 ClassCount;
+    const FNamingConventionCompiledClassDescription * ClassDescriptions;
+    int32 ClassDescriptionCount;
+    // Perfect hash of the class paths, with HashClassPath. Each slot holds the index of a class, or INDEX_NONE. The slot count is a power of two
+    const int32 * ClassSlots;
+    int32 ClassSlotCount;
+    uint32 HashSeed;
+};
+
+// Matches the asset names against the class descriptions of the settings with the tables of a generated module,
+// in place of going through all the class descriptions of the settings
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationCompiledMatcher
+{
+public:
+    // Called by the generated module when it starts and when it shuts down
+    static void RegisterTable( const FNamingConventionCompiledMatcherTable & table );
+    static void UnregisterTable( const FNamingConventionCompiledMatcherTable & table );
+    static FSimpleMulticastDelegate & OnRegisteredTablesChanged();
+
+    // Hash of the class paths, of the affixes and of the order of the class descriptions of the settings
+    static FString GetClassDescriptionsFingerprint( const UNamingConventionValidationSettings & settings );
+    // nullptr when no registered table was generated from the current class descriptions of the settings, or when some of their classes are not valid
+    static const FNamingConventionCompiledMatcherTable * FindTable( const UNamingConventionValidationSettings & settings );
+
+    static uint32 HashClassPath( FStringView class_path, uint32 seed );
+    // The most precise class of the table the asset class derives from, or nullptr. Walks the class hierarchy and hashes the path of each class,
+    // so the callers which match many assets go through FNamingConventionCompiledClassCache
+    static const FNamingConventionCompiledClass * FindClass( const FNamingConventionCompiledMatcherTable & table, const UClass * asset_class );
+    // The same class descriptions as GatherApplicableClassDescriptions on the class descriptions of the settings: the ones of the most precise class the asset class derives from
+    static void GatherClassDescriptions( TArray< int32, FNamingConventionScratchAllocator > & class_description_indices, const FNamingConventionCompiledMatcherTable & table, const FNamingConventionCompiledClass * compiled_class );
+    // The same verdict as DoesAssetMatchesClassDescriptions on the class descriptions of the settings. failed_class_description_index is an index of the class descriptions of the settings
+    static ENamingConventionValidationResult MatchName( int32 & failed_class_description_index, bool & it_has_wrong_suffix, const FNamingConventionCompiledMatcherTable & table, const FNamingConventionCompiledClass * compiled_class, FStringView asset_name );
+
+    // Writes <module_name>.Build.cs and Private/<module_name>Module.cpp in module_directory, for a module which registers the tables of the class descriptions of the settings.
+    // Fails when a class description has no valid class, since the dynamic matching reports them
+    static bool GenerateModule( FString & error, const FString & module_directory, const FString & module_name, const UNamingConventionValidationSettings & settings );
+};
+
+// The compiled class of each class already looked up in a table, including the classes without one, so the hierarchy of a class is only walked once.
+// Game thread only: the batches look up their classes before matching the names on the worker threads.
+// The classes are only compared by address, so the cache is reset when classes can be destroyed or reparented
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionCompiledClassCache
+{
+public:
+    void Reset( const FNamingConventionCompiledMatcherTable * table );
+
+    // nullptr when the cache has no table, or when the class does not derive from a class of the table
+    const FNamingConventionCompiledClass * FindClass( const UClass * asset_class );
+
+private:
+    const FNamingConventionCompiledMatcherTable * Table = nullptr;
+    TMap< const UClass *, const FNamingConventionCompiledClass * > CompiledClasses;
+};
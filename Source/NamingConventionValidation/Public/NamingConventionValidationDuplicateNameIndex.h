@@ -0,0 +1,47 @@
+#pragma once
+
+#include <CoreMinimal.h>
+#include <UObject/TopLevelAssetPath.h>
+
+struct FAssetData;
+
+// Case insensitive index of the asset names, used to find the assets sharing their name with another asset located in another folder
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationDuplicateNameIndex
+{
+public:
+    explicit FNamingConventionValidationDuplicateNameIndex( bool scope_by_class = false );
+
+    void Reset( bool scope_by_class );
+    void Reserve( int32 asset_count );
+
+    // Adds the asset if it's not already in the index, and returns the package of another asset registered with the same name, or NAME_None
+    FName Add( const FAssetData & asset_data );
+    void Remove( FName package_name, FName asset_name, const FTopLevelAssetPath & asset_class_path );
+
+    bool IsScopedByClass() const;
+    int32 Num() const;
+
+private:
+    struct FKey
+    {
+        FName AssetName;
+        FTopLevelAssetPath AssetClassPath;
+
+        bool operator==( const FKey & other ) const
+        {
+            // FName comparisons ignore the case
+            return AssetName == other.AssetName && AssetClassPath == other.AssetClassPath;
+        }
+
+        friend uint32 GetTypeHash( const FKey & key )
+        {
+            return HashCombine( GetTypeHash( key.AssetName ), GetTypeHash( key.AssetClassPath ) );
+        }
+    };
+
+    FKey MakeKey( FName asset_name, const FTopLevelAssetPath & asset_class_path ) const;
+
+    TMap< FKey, TArray< FName, TInlineAllocator< 1 > > > PackagesByName;
+    int32 PackageCount;
+    bool ItIsScopedByClass;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include <AssetRegistry/AssetData.h>
+#include <CoreMinimal.h>
+
+// Names, class paths and paths of the assets of the project, without their tags, to evaluate candidate settings on all of them at once.
+// Redirectors and World Partition external packages are left out. The classes are resolved by each analysis, since blueprint classes can be unloaded meanwhile
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationImpactSnapshot
+{
+public:
+    void Reset();
+    void Reserve( int32 asset_count );
+    // asset_class_path is the native class of blueprints, like the class TryGetAssetDataRealClass resolves
+    void Add( const FAssetData & asset_data, const FTopLevelAssetPath & asset_class_path );
+    void Remove( const FSoftObjectPath & object_path );
+
+    int32 Num() const;
+    TConstArrayView< FAssetData > GetAssetDataList() const;
+    TConstArrayView< FTopLevelAssetPath > GetAssetClassPaths() const;
+
+private:
+    TArray< FAssetData > AssetDataList;
+    TArray< FTopLevelAssetPath > AssetClassPaths;
+    TMap< FSoftObjectPath, int32 > AssetIndices;
+};
+
+// An asset whose verdict differs between the current and the candidate settings
+struct FNamingConventionImpactChange
+{
+    FString ToString() const;
+
+    FName PackageName;
+    ENamingConventionValidationResult PreviousResult = ENamingConventionValidationResult::Unknown;
+    FName PreviousRuleId;
+    ENamingConventionValidationResult Result = ENamingConventionValidationResult::Unknown;
+    FName RuleId;
+};
+
+struct FNamingConventionRuleImpact
+{
+    int32 NewViolationCount = 0;
+    int32 FixedViolationCount = 0;
+};
+
+// Difference between the verdicts of the current settings and the ones of candidate settings, filled by UEditorNamingValidatorSubsystem::AnalyzeSettingsImpact
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionSettingsImpact
+{
+    void Reset();
+    void AddVerdicts( FName package_name, ENamingConventionValidationResult previous_result, FName previous_rule_id, ENamingConventionValidationResult result, FName rule_id );
+    // The totals, then one line per rule whose violations change
+    void GetReportLines( TArray< FString > & lines ) const;
+
+    // Only the rules whose violations change
+    TMap< FName, FNamingConventionRuleImpact > RuleImpacts;
+    TArray< FNamingConventionImpactChange > Changes;
+    int32 AssetCount = 0;
+    // The assets whose class is not loaded when the analysis runs can not be evaluated
+    int32 UnresolvedClassCount = 0;
+    // The class descriptions of the candidate settings whose class can not be loaded, which are ignored
+    int32 InvalidClassDescriptionCount = 0;
+    int32 NewViolationCount = 0;
+    int32 FixedViolationCount = 0;
+    int32 NewlyExcludedCount = 0;
+    int32 NewlyIncludedCount = 0;
+    double Seconds = 0.0;
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <CoreMinimal.h>
+#include <HAL/LowLevelMemTracker.h>
+#include <Misc/MemStack.h>
+
+#include <atomic>
+
+// All the memory allocated by the validation is tracked under this tag in the LLM reports (-llm, -llmcsv, or the Memory Insights)
+LLM_DECLARE_TAG_API( NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+
+// Memory used during a validation run, and reported in the summary of the run.
+// The scratch allocations and the peak of the scratch scopes are the ones of the validation itself, counted while the stats are the current ones of the thread.
+// The physical memory is the one of the whole process, sampled between the batches
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationMemoryStats
+{
+public:
+    UE_NONCOPYABLE( FNamingConventionValidationMemoryStats );
+
+    // Makes the stats the current ones of the thread while the scope lives. The stats can be null, to not count the allocations of a nested run.
+    // The workers of a ParallelFor open their own scope, with the stats the calling thread got from GetCurrent
+    class NAMINGCONVENTIONVALIDATION_API FScope
+    {
+    public:
+        UE_NONCOPYABLE( FScope );
+
+        explicit FScope( FNamingConventionValidationMemoryStats * stats );
+        ~FScope();
+
+    private:
+        FNamingConventionValidationMemoryStats * PreviousStats;
+    };
+
+    FNamingConventionValidationMemoryStats();
+
+    static FNamingConventionValidationMemoryStats * GetCurrent();
+
+    void Reset();
+    void Sample();
+    void AddScratchAllocation();
+    void AddScratchScopeByteCount( int64 byte_count );
+
+    int64 GetPeakUsedPhysical() const;
+    // The peak memory of the process, and the scratch allocations per asset with the peak of the scratch scopes
+    void GetReportLines( TArray< FString > & lines, int32 asset_count ) const;
+
+private:
+    uint64 StartUsedPhysical;
+    uint64 PeakUsedPhysical;
+    // Updated by the workers of the run
+    std::atomic< int64 > ScratchAllocationCount;
+    std::atomic< int64 > ScratchPeakByteCount;
+};
+
+// The transient data allocated with FNamingConventionScratchAllocator in the scope is released in bulk when the scope ends.
+// The arena is the FMemStack of the thread, so each worker of a ParallelFor uses its own
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationScratchScope
+{
+public:
+    UE_NONCOPYABLE( FNamingConventionValidationScratchScope );
+
+    FNamingConventionValidationScratchScope();
+    ~FNamingConventionValidationScratchScope();
+
+private:
+    FMemMark Mark;
+    // The FMemStack of the thread can hold the data of other marks, like the ones of the engine on the game thread
+    int64 StartByteCount;
+    FNamingConventionValidationMemoryStats * Stats;
+};
+
+// Allocates from the scratch arena of the thread. Only for the transient data of a FNamingConventionValidationScratchScope.
+// Each allocation is counted in the current memory stats of the thread
+class FNamingConventionScratchAllocator
+{
+public:
+    using SizeType = int32;
+
+    enum
+    {
+        NeedsElementType = true
+    };
+    enum
+    {
+        RequireRangeCheck = true
+    };
+
+    template < typename ElementType >
+    class ForElementType : public TMemStackAllocator<>::ForElementType< ElementType >
+    {
+    public:
+        void ResizeAllocation( const SizeType previous_num_elements, const SizeType num_elements, const SIZE_T num_bytes_per_element )
+        {
+            // The arena does not free, so each resize to a non empty allocation is a new block
+            if ( num_elements > 0 )
+            {
+                if ( auto * stats = FNamingConventionValidationMemoryStats::GetCurrent() )
+                {
+                    stats->AddScratchAllocation();
+                }
+            }
+
+            TMemStackAllocator<>::ForElementType< ElementType >::ResizeAllocation( previous_num_elements, num_elements, num_bytes_per_element );
+        }
+    };
+
+    typedef void ForAnyElementType;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include <CoreMinimal.h>
+
+// Result of the latest validation of each package.
+// The package names are also kept sorted, so the results of a folder can be queried without going through all the results
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationResultStore
+{
+public:
+    FNamingConventionValidationResultStore();
+
+    void Reset();
+
+    // Replaces the previous result of the package
+    void Add( const FNamingConventionValidationStoredResult & result );
+    void Remove( FName package_name );
+    const FNamingConventionValidationStoredResult * Find( FName package_name ) const;
+
+    // Marks all the results as stale, for example when the settings change. They are kept until the packages are validated again
+    void Invalidate();
+    bool IsStale( const FNamingConventionValidationStoredResult & result ) const;
+
+    // Adds the results of the packages in the folder and its sub-folders, in O(log n + k) once the package names are sorted.
+    // path can also be a package name
+    void GetResultsInPath( TArray< FNamingConventionValidationStoredResult > & results, FStringView path, bool only_invalid_results = false ) const;
+
+    int32 Num() const;
+
+    // Broadcast when a package gets a result, when its result changes, when it is removed, and when the results are reset or invalidated
+    FSimpleMulticastDelegate & OnResultsChanged();
+
+private:
+    void SortPackageNames() const;
+
+    TMap< FName, FNamingConventionValidationStoredResult > ResultsByPackage;
+
+    // Sorted again on the first query following the addition of new packages
+    mutable TArray< FName > SortedPackageNames;
+    mutable bool ItHasSortedPackageNames;
+
+    FDateTime InvalidationTime;
+
+    FSimpleMulticastDelegate ResultsChangedDelegate;
+};
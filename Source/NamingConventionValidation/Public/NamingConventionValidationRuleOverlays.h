@@ -0,0 +1,33 @@
+#pragma once
+
+#include "NamingConventionValidationSettings.h"
+
+#include <CoreMinimal.h>
+
+// The rule overlays of the settings compiled into a tree of folders, where each folder of an overlay holds the class descriptions which apply in it.
+// Finding the class descriptions of an asset only walks the folders of its path. Once built, it's read only and can be used from any thread
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationRuleOverlays
+{
+public:
+    FNamingConventionValidationRuleOverlays();
+
+    // The class descriptions of the settings and of the overlays must be up to date
+    void Build( const UNamingConventionValidationSettings & settings );
+    void Reset();
+    bool IsEmpty() const;
+
+    // Returns INDEX_NONE when no overlay applies to the folder, in which case the class descriptions of the settings apply
+    int32 FindClassDescriptionSet( FName package_path ) const;
+    int32 FindClassDescriptionSet( FStringView package_path ) const;
+    TConstArrayView< FNamingConventionValidationClassDescription > GetClassDescriptionSet( int32 set_index ) const;
+
+private:
+    struct FNode
+    {
+        TMap< FName, int32 > Children;
+        int32 SetIndex = INDEX_NONE;
+    };
+
+    TArray< FNode > Nodes;
+    TArray< TArray< FNamingConventionValidationClassDescription > > ClassDescriptionSets;
+};
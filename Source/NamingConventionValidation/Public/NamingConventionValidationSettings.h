@@ -6,6 +6,15 @@
 
 #include "NamingConventionValidationSettings.generated.h"
 
+UENUM()
+enum class ENamingConventionExternalPackagesValidationMode : uint8
+{
+    // The packages are excluded without being processed
+    Skip,
+    // The actor labels are validated against the class descriptions, using only the asset registry tags of the packages
+    ValidateActorLabels
+};
+
 USTRUCT()
 struct FNamingConventionValidationClassDescription
 {
@@ -37,6 +46,40 @@ struct FNamingConventionValidationClassDescription
 
     UPROPERTY( config, EditAnywhere )
     int Priority;
+
+    // Identifies the class description in the validation results
+    UPROPERTY( transient )
+    FName RuleId;
+};
+
+UENUM()
+enum class ENamingConventionRuleOverlayMode : uint8
+{
+    // The class descriptions of the overlay replace the ones of the same classes, the other ones still apply
+    Extend,
+    // Only the class descriptions of the overlay apply
+    Override
+};
+
+// Class descriptions which only apply to the assets of a folder and of its sub-folders, like the mount point of a plugin.
+// The overlays of sub-folders apply on top of the ones of their parent folders
+USTRUCT()
+struct FNamingConventionValidationRuleOverlay
+{
+    GENERATED_USTRUCT_BODY()
+
+    FNamingConventionValidationRuleOverlay() :
+        Mode( ENamingConventionRuleOverlayMode::Extend )
+    {}
+
+    UPROPERTY( config, EditAnywhere, meta = ( LongPackageName ) )
+    FDirectoryPath Folder;
+
+    UPROPERTY( config, EditAnywhere )
+    ENamingConventionRuleOverlayMode Mode;
+
+    UPROPERTY( config, EditAnywhere )
+    TArray< FNamingConventionValidationClassDescription > ClassDescriptions;
 };
 
 UCLASS( config = Editor, DefaultConfig )
@@ -47,9 +90,17 @@ class NAMINGCONVENTIONVALIDATION_API UNamingConventionValidationSettings final :
 public:
     UNamingConventionValidationSettings();
 
-    bool IsPathExcludedFromValidation( const FString & path ) const;
+    static bool IsExternalActorPath( FStringView path );
+    static bool IsExternalObjectPath( FStringView path );
 
-    UPROPERTY( config, EditAnywhere, meta = ( LongPackageName, ConfigRestartRequired = true ) )
+    // Takes a view so the package names can be tested from a string builder, without allocating
+    bool IsPathExcludedFromValidation( FStringView path ) const;
+    // Returns true only if every package located directly in the folder would be excluded by IsPathExcludedFromValidation
+    bool IsFolderExcludedFromValidation( const FString & folder_path ) const;
+    // Fills the classes which can be excluded by the asset registry itself. Classes the registry can not reason about are left to IsClassExcluded
+    void GetAssetRegistryExcludedClassPaths( TSet< FTopLevelAssetPath > & class_paths ) const;
+
+    UPROPERTY( config, EditAnywhere, meta = ( LongPackageName ) )
     TArray< FDirectoryPath > ExcludedDirectories;
 
     UPROPERTY( config, EditAnywhere )
@@ -62,19 +113,70 @@ public:
     uint8 bAllowValidationOnlyInGameFolder : 1;
 
     // Add folders located outside of /Game that you still want to process when bAllowValidationOnlyInGameFolder is checked
-    UPROPERTY( config, EditAnywhere, meta = ( LongPackageName, ConfigRestartRequired = true, editCondition = "bAllowValidationOnlyInGameFolder" ) )
+    UPROPERTY( config, EditAnywhere, meta = ( LongPackageName, editCondition = "bAllowValidationOnlyInGameFolder" ) )
     TArray< FDirectoryPath > NonGameFoldersDirectoriesToProcess;
 
     // Add folders located outside of /Game that you still want to process when bAllowValidationOnlyInGameFolder is checked, and which contain one of those tokens in their path
-    UPROPERTY( config, EditAnywhere, meta = ( LongPackageName, ConfigRestartRequired = true, editCondition = "bAllowValidationOnlyInGameFolder" ) )
+    UPROPERTY( config, EditAnywhere, meta = ( LongPackageName, editCondition = "bAllowValidationOnlyInGameFolder" ) )
     TArray< FString > NonGameFoldersDirectoriesToProcessContainingToken;
 
     UPROPERTY( config, EditAnywhere )
     uint8 bDoesValidateOnSave : 1;
 
-    UPROPERTY( config, EditAnywhere, meta = ( ConfigRestartRequired = true ) )
+    // Validate the assets of an import together once the import is done, instead of one after the other when they get saved
+    UPROPERTY( config, EditAnywhere )
+    uint8 bValidateOnImport : 1;
+
+    // Add the prefix and the suffix of their class description to the imported assets which do not have them, before they are saved for the first time
+    UPROPERTY( config, EditAnywhere, meta = ( editCondition = "bValidateOnImport" ) )
+    uint8 bApplyAffixesOnImport : 1;
+
+    // Validate the folders from the content browser and the main menu over several frames, without blocking the editor
+    UPROPERTY( config, EditAnywhere )
+    uint8 bValidateFoldersInBackground : 1;
+
+    // Time spent validating assets at each frame when validating in background
+    UPROPERTY( config, EditAnywhere, meta = ( editCondition = "bValidateFoldersInBackground", ClampMin = 1, Units = "ms" ) )
+    float BackgroundValidationTimeBudgetMs;
+
+    // A validator which takes longer to validate one asset is disabled until the end of the validation, and the next assets are reported as not evaluated by it. 0 for no budget
+    UPROPERTY( config, EditAnywhere, meta = ( ClampMin = 0, Units = "ms" ) )
+    float ValidatorCallTimeBudgetMs;
+
+    // A validator which spends more time in total during a validation is disabled until the end of it, like with ValidatorCallTimeBudgetMs. 0 for no budget
+    UPROPERTY( config, EditAnywhere, meta = ( ClampMin = 0, Units = "ms" ) )
+    float ValidatorRunTimeBudgetMs;
+
+    // Also run the naming convention validation from the Data Validation plugin, so its commandlet and menus report the naming errors too
+    UPROPERTY( config, EditAnywhere )
+    uint8 bValidateWithDataValidation : 1;
+
+    // Share the verdicts through the Derived Data Cache, so the machines using the same shared cache do not validate the same packages again.
+    // A verdict is only reused for the same saved package, with the same settings, validators and rules, and the same version of the plugins of the native validators.
+    // The native validators of the project modules use the version of the project, which must change with their code
+    UPROPERTY( config, EditAnywhere )
+    uint8 bShareVerdictsThroughDerivedDataCache : 1;
+
+    // Validate the assets of the packages the cook saves, reusing its asset registry and its loaded classes. Can also be enabled with -ValidateNamingConvention on the cook command line.
+    // -NamingConventionBaseline=<file> only reports the violations which are not in the baseline, and -NamingConventionCookReport=<file> overrides where the report is written
+    UPROPERTY( config, EditAnywhere )
+    uint8 bValidateWhileCooking : 1;
+
+    // Log an error for each new violation found while cooking, which makes the cook fail
+    UPROPERTY( config, EditAnywhere, meta = ( editCondition = "bValidateWhileCooking" ) )
+    uint8 bFailCookOnNewViolations : 1;
+
+    // How the World Partition packages stored in the __ExternalActors__ and __ExternalObjects__ folders are processed. External objects are always skipped
+    UPROPERTY( config, EditAnywhere )
+    ENamingConventionExternalPackagesValidationMode ExternalPackagesValidationMode;
+
+    UPROPERTY( config, EditAnywhere )
     TArray< FNamingConventionValidationClassDescription > ClassDescriptions;
 
+    // Class descriptions for the plugins or the folders whose naming convention differs from the one of the project
+    UPROPERTY( config, EditAnywhere )
+    TArray< FNamingConventionValidationRuleOverlay > RuleOverlays;
+
     UPROPERTY( config, EditAnywhere )
     TArray< TSoftClassPtr< UObject > > ExcludedClassPaths;
 
@@ -84,9 +186,24 @@ public:
     UPROPERTY( config, EditAnywhere )
     FString BlueprintsPrefix;
 
+    // Reports the assets which have the same name as another asset located in another folder. The comparison ignores the case
+    UPROPERTY( config, EditAnywhere )
+    uint8 bDetectDuplicateAssetNames : 1;
+
+    // Only consider assets of the same class as duplicates
+    UPROPERTY( config, EditAnywhere, meta = ( editCondition = "bDetectDuplicateAssetNames" ) )
+    uint8 bDuplicateAssetNamesAreScopedByClass : 1;
+
     void PostProcessSettings();
 
 #if WITH_EDITOR
     virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
+
+private:
+    static void RebuildClassDescriptions( TArray< FNamingConventionValidationClassDescription > & class_descriptions, const FString & rule_id_suffix );
+    void RebuildClassDescriptions();
+    void RebuildRuleOverlays();
+    void RebuildExcludedClasses();
+    void RebuildExcludedDirectories();
 };
\ No newline at end of file
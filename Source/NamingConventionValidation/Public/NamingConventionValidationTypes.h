@@ -1,12 +1,63 @@
 #pragma once
 
+#include <CoreMinimal.h>
+
 #include "NamingConventionValidationTypes.generated.h"
 
-UENUM()
+UENUM( BlueprintType )
 enum class ENamingConventionValidationResult : uint8
 {
     Invalid,
     Valid,
     Unknown,
     Excluded
-};
\ No newline at end of file
+};
+
+USTRUCT( BlueprintType )
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationVerdict
+{
+    GENERATED_USTRUCT_BODY()
+
+    FNamingConventionValidationVerdict() :
+        Result( ENamingConventionValidationResult::Unknown )
+    {}
+
+    UPROPERTY( BlueprintReadOnly, Category = "Asset Naming Validation" )
+    FName PackageName;
+
+    UPROPERTY( BlueprintReadOnly, Category = "Asset Naming Validation" )
+    FName AssetName;
+
+    UPROPERTY( BlueprintReadOnly, Category = "Asset Naming Validation" )
+    ENamingConventionValidationResult Result;
+
+    // Identifies the rule the asset does not comply with when the result is Invalid
+    UPROPERTY( BlueprintReadOnly, Category = "Asset Naming Validation" )
+    FName RuleId;
+
+    UPROPERTY( BlueprintReadOnly, Category = "Asset Naming Validation" )
+    FText Message;
+};
+
+USTRUCT( BlueprintType )
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationStoredResult
+{
+    GENERATED_USTRUCT_BODY()
+
+    FNamingConventionValidationStoredResult() :
+        Result( ENamingConventionValidationResult::Unknown )
+    {}
+
+    UPROPERTY( BlueprintReadOnly, Category = "Asset Naming Validation" )
+    FName PackageName;
+
+    UPROPERTY( BlueprintReadOnly, Category = "Asset Naming Validation" )
+    ENamingConventionValidationResult Result;
+
+    UPROPERTY( BlueprintReadOnly, Category = "Asset Naming Validation" )
+    FName RuleId;
+
+    // UTC time of the validation
+    UPROPERTY( BlueprintReadOnly, Category = "Asset Naming Validation" )
+    FDateTime ValidationTime;
+};
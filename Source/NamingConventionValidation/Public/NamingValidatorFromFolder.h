@@ -17,6 +17,10 @@ public:
     bool CanValidateAssetNaming_Implementation( const UClass * asset_class, const FAssetData & asset_data ) const override;
     ENamingConventionValidationResult ValidateAssetNaming_Implementation( FText & error_message, const UClass * asset_class, const FAssetData & asset_data ) override;
 
+    bool IsThreadSafe() const override;
+    FNamingConventionNativeVerdict ValidateAssetNamingThreadSafe( const FNamingConventionValidationContext & context ) const override;
+    FText GetThreadSafeVerdictMessage( const FNamingConventionValidationContext & context, const FNamingConventionNativeVerdict & verdict ) const override;
+
 protected:
     // The root folder that this rule will be applied to (Eg /Game)
     UPROPERTY( EditDefaultsOnly )